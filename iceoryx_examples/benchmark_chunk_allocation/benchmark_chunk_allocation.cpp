@@ -0,0 +1,146 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000u};
+/// number of chunks which are allocated before they are released again, like a publisher which loans several samples
+constexpr uint32_t CHUNKS_PER_ITERATION{4u};
+constexpr uint32_t PAYLOAD_SIZE{128u};
+constexpr uint32_t MAGAZINE_CAPACITY{32u};
+constexpr uint32_t MAX_NUMBER_OF_THREADS{64u};
+
+using ChunkQueueData_t = iox::popo::ChunkQueueData<iox::DefaultChunkQueueConfig, iox::popo::ThreadSafePolicy>;
+using ChunkDistributorData_t = iox::popo::ChunkDistributorData<iox::DefaultChunkDistributorConfig,
+                                                               iox::popo::ThreadSafePolicy,
+                                                               iox::popo::ChunkQueuePusher<ChunkQueueData_t>>;
+
+template <uint32_t MagazineCapacity>
+using ChunkSenderData_t = iox::popo::
+    ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t, MagazineCapacity>;
+
+std::atomic<uint64_t> globalFailedAllocations{0u};
+
+/// @brief every thread has its own chunk sender, like a process with one publisher per thread, all of them allocate
+/// from the same mempool
+template <uint32_t MagazineCapacity>
+double measureNanoSecondsPerAllocation(iox::mepoo::MemoryManager& memoryManager, const uint32_t numberOfThreads)
+{
+    std::vector<std::unique_ptr<ChunkSenderData_t<MagazineCapacity>>> chunkSenderData;
+    for (uint32_t i = 0u; i < numberOfThreads; ++i)
+    {
+        chunkSenderData.emplace_back(new ChunkSenderData_t<MagazineCapacity>(&memoryManager));
+    }
+
+    std::atomic_bool start{false};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0u; i < numberOfThreads; ++i)
+    {
+        threads.emplace_back([&, i] {
+            iox::popo::ChunkSender<ChunkSenderData_t<MagazineCapacity>> chunkSender(chunkSenderData[i].get());
+            iox::UniquePortId originId;
+            iox::mepoo::ChunkHeader* chunks[CHUNKS_PER_ITERATION];
+            while (!start.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            for (uint64_t iteration = 0u; iteration < NUMBER_OF_ITERATIONS; ++iteration)
+            {
+                for (auto& chunk : chunks)
+                {
+                    chunkSender.tryAllocate(PAYLOAD_SIZE, originId)
+                        .and_then([&](iox::mepoo::ChunkHeader* chunkHeader) { chunk = chunkHeader; })
+                        .or_else([&](iox::popo::AllocationError) {
+                            chunk = nullptr;
+                            globalFailedAllocations.fetch_add(1u, std::memory_order_relaxed);
+                        });
+                }
+                for (auto chunk : chunks)
+                {
+                    if (chunk != nullptr)
+                    {
+                        chunkSender.release(chunk);
+                    }
+                }
+            }
+            chunkSender.releaseAll();
+        });
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count())
+           / static_cast<double>(NUMBER_OF_ITERATIONS * CHUNKS_PER_ITERATION);
+}
+
+int main()
+{
+    iox::popo::internal::setUniqueRouDiId(0u);
+
+    const uint32_t maxNumberOfThreads =
+        std::min(std::max(std::thread::hardware_concurrency(), 1u), MAX_NUMBER_OF_THREADS);
+
+    iox::mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({PAYLOAD_SIZE, maxNumberOfThreads * (MAGAZINE_CAPACITY + CHUNKS_PER_ITERATION)});
+
+    // additional memory for the alignment of the mempools
+    const uint64_t memorySize = iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig) + 2u * 1024u;
+    std::unique_ptr<char[]> memory(new char[memorySize]);
+    iox::posix::Allocator allocator(memory.get(), memorySize);
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, &allocator, &allocator);
+
+    std::cout << "Chunk allocation with one chunk sender per thread, wall clock time per allocation and release in ns"
+              << std::endl;
+    std::cout << "   threads | without magazine [ns] | with magazine [ns]" << std::endl;
+    for (uint32_t numberOfThreads = 1u; numberOfThreads <= maxNumberOfThreads; numberOfThreads *= 2u)
+    {
+        auto withoutMagazine = measureNanoSecondsPerAllocation<0u>(memoryManager, numberOfThreads);
+        auto withMagazine = measureNanoSecondsPerAllocation<MAGAZINE_CAPACITY>(memoryManager, numberOfThreads);
+
+        std::cout << std::setw(10) << numberOfThreads << " | " << std::setw(21) << std::fixed << std::setprecision(2)
+                  << withoutMagazine << " | " << std::setw(18) << withMagazine << std::endl;
+    }
+
+    iox::popo::internal::unsetUniqueRouDiId();
+
+    return (globalFailedAllocations.load() == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/cxx/vector.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+constexpr uint64_t NUMBER_OF_LOOKUPS{10000000u};
+constexpr uint64_t NUMBER_OF_PAYLOAD_SIZES{1024u};
+
+uint64_t globalCounter{0u};
+
+/// @brief the lookup as it was done by MemoryManager::getMempoolChunkSizeForPayloadSize before the size class lookup
+/// table, a linear search over the same MemPool objects as the MemoryManager uses
+uint32_t linearLookup(const iox::cxx::vector<iox::mepoo::MemPool, iox::MAX_NUMBER_OF_MEMPOOLS>& memPools,
+                      const uint32_t payloadSize)
+{
+    uint32_t adjustedSize = iox::mepoo::MemoryManager::sizeWithChunkHeaderStruct(payloadSize);
+    for (auto& memPool : memPools)
+    {
+        const auto chunkSize = memPool.getChunkSize();
+        if (chunkSize >= adjustedSize)
+        {
+            return chunkSize;
+        }
+    }
+
+    return 0;
+}
+
+template <typename Lookup>
+double measureNanoSecondsPerCall(const std::vector<uint32_t>& payloadSizes, Lookup&& lookup)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0u; i < NUMBER_OF_LOOKUPS; ++i)
+    {
+        globalCounter += lookup(payloadSizes[i % NUMBER_OF_PAYLOAD_SIZES]);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+           / static_cast<double>(NUMBER_OF_LOOKUPS);
+}
+
+void benchmark(const uint32_t numberOfMemPools)
+{
+    iox::mepoo::MePooConfig mempoolConfig;
+    for (uint32_t i = 1u; i <= numberOfMemPools; ++i)
+    {
+        // a mixture of small and large mempools as it is used in typical configurations
+        const uint32_t payloadSize = i * i * 128u;
+        mempoolConfig.addMemPool({payloadSize, 1u});
+    }
+
+    // additional memory for the alignment of the mempools
+    const uint64_t memorySize =
+        iox::mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig) + (numberOfMemPools + 1u) * 1024u;
+    std::unique_ptr<char[]> memory(new char[memorySize]);
+    iox::posix::Allocator allocator(memory.get(), memorySize);
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, &allocator, &allocator);
+
+    // the same mempools as in the MemoryManager for the linear search
+    std::unique_ptr<char[]> linearMemory(new char[memorySize]);
+    iox::posix::Allocator linearAllocator(linearMemory.get(), memorySize);
+    iox::cxx::vector<iox::mepoo::MemPool, iox::MAX_NUMBER_OF_MEMPOOLS> memPools;
+    for (const auto& entry : mempoolConfig.m_mempoolConfig)
+    {
+        memPools.emplace_back(iox::mepoo::MemoryManager::sizeWithChunkHeaderStruct(entry.m_size),
+                              entry.m_chunkCount,
+                              &linearAllocator,
+                              &linearAllocator);
+    }
+
+    std::mt19937 generator(42u);
+    std::uniform_int_distribution<uint32_t> distribution(1u, numberOfMemPools * numberOfMemPools * 128u);
+    std::vector<uint32_t> payloadSizes;
+    for (uint64_t i = 0u; i < NUMBER_OF_PAYLOAD_SIZES; ++i)
+    {
+        payloadSizes.push_back(distribution(generator));
+    }
+
+    auto linear = measureNanoSecondsPerCall(
+        payloadSizes, [&](const uint32_t payloadSize) { return linearLookup(memPools, payloadSize); });
+    auto sizeClass = measureNanoSecondsPerCall(payloadSizes, [&](const uint32_t payloadSize) {
+        return memoryManager.getMempoolChunkSizeForPayloadSize(payloadSize);
+    });
+
+    std::cout << std::setw(10) << numberOfMemPools << " | " << std::setw(14) << std::fixed << std::setprecision(2)
+              << linear << " | " << std::setw(14) << sizeClass << std::endl;
+}
+
+int main()
+{
+    std::cout << "Lookup of the fitting mempool, average time per lookup in ns" << std::endl;
+    std::cout << "  mempools |    linear [ns] | size class [ns]" << std::endl;
+    for (uint32_t numberOfMemPools : {1u, 4u, 8u, 16u, 32u})
+    {
+        benchmark(numberOfMemPools);
+    }
+
+    // prevents the compiler from optimizing the lookups away
+    return (globalCounter == 0u) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
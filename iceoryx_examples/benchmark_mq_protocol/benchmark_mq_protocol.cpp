@@ -0,0 +1,158 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_utils/cxx/convert.hpp"
+#include "iceoryx_utils/log/logmanager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace iox::units::duration_literals;
+
+constexpr char APP_NAME[]{"/iox-bm-mq-protocol"};
+constexpr uint32_t NUMBER_OF_REGISTRATIONS{100u};
+/// the publisher ports stay in the port pool until the end of the benchmark, both protocols together must not exceed
+/// IOX_MAX_PUBLISHERS
+constexpr uint32_t NUMBER_OF_PUBLISHERS{200u};
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief sends a CREATE_PUBLISHER request like the runtime does and parses the relative pointer of the answer
+bool createPublisher(iox::runtime::MqRuntimeInterface& mqInterface, const iox::capro::ServiceDescription& service)
+{
+    const iox::RunnableName_t runnableName{""};
+    const iox::runtime::PortConfigInfo portConfigInfo;
+    const uint64_t historyCapacity{0u};
+
+    if (mqInterface.getProtocol() == iox::runtime::MqProtocol::BINARY)
+    {
+        iox::runtime::MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(iox::runtime::MqMessageType::CREATE_PUBLISHER))
+            .addString(APP_NAME, sizeof(APP_NAME) - 1u)
+            .addServiceDescription(service)
+            .addUnsigned(historyCapacity)
+            .addString(runnableName)
+            .addPortConfigInfo(portConfigInfo);
+
+        iox::runtime::MqBinaryMessage receiveBuffer;
+        int64_t type{0};
+        uint64_t offset{0u};
+        uint64_t segmentId{0u};
+        return mqInterface.sendRequestToRouDi(sendBuffer, receiveBuffer) && receiveBuffer.readSigned(type)
+               && type == static_cast<int64_t>(iox::runtime::MqMessageType::CREATE_PUBLISHER_ACK)
+               && receiveBuffer.readUnsigned(offset) && receiveBuffer.readUnsigned(segmentId);
+    }
+
+    iox::runtime::MqMessage sendBuffer;
+    sendBuffer << iox::runtime::mqMessageTypeToString(iox::runtime::MqMessageType::CREATE_PUBLISHER) << APP_NAME
+               << static_cast<iox::cxx::Serialization>(service).toString() << std::to_string(historyCapacity)
+               << runnableName << static_cast<iox::cxx::Serialization>(portConfigInfo).toString();
+
+    iox::runtime::MqMessage receiveBuffer;
+    iox::RelativePointer::offset_t offset{0u};
+    iox::RelativePointer::id_t segmentId{0u};
+    return mqInterface.sendRequestToRouDi(sendBuffer, receiveBuffer) && receiveBuffer.getNumberOfElements() == 3u
+           && iox::runtime::stringToMqMessageType(receiveBuffer.getElementAtIndex(0).c_str())
+                  == iox::runtime::MqMessageType::CREATE_PUBLISHER_ACK
+           && iox::cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), offset)
+           && iox::cxx::convert::fromString(receiveBuffer.getElementAtIndex(2).c_str(), segmentId);
+}
+
+double toMicroSeconds(const Clock::duration duration)
+{
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / 1000.0;
+}
+
+void printResult(const char* protocol, const char* request, std::vector<double>& latencies)
+{
+    std::sort(latencies.begin(), latencies.end());
+    const double mean = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    std::cout << std::setw(8) << protocol << " | " << std::setw(16) << request << " | " << std::setw(8)
+              << latencies.size() << " | " << std::setw(8) << std::fixed << std::setprecision(2) << latencies.front()
+              << " | " << std::setw(11) << latencies[latencies.size() / 2u] << " | " << std::setw(9) << mean
+              << std::endl;
+}
+
+/// @brief measures the round trip of the registration and of the port creation with the given protocol
+/// @return false if a request failed
+bool measureProtocol(const iox::runtime::MqProtocol protocol, const char* protocolName)
+{
+    std::vector<double> registrationLatencies;
+    std::vector<double> portCreationLatencies;
+    registrationLatencies.reserve(NUMBER_OF_REGISTRATIONS);
+    portCreationLatencies.reserve(NUMBER_OF_PUBLISHERS);
+
+    std::unique_ptr<iox::runtime::MqRuntimeInterface> mqInterface;
+    for (uint32_t registration = 0u; registration < NUMBER_OF_REGISTRATIONS; ++registration)
+    {
+        // the registration removes the not monitored application of the previous registration
+        mqInterface.reset();
+        auto begin = Clock::now();
+        mqInterface.reset(new iox::runtime::MqRuntimeInterface(iox::MQ_ROUDI_NAME, APP_NAME, 1_s, protocol));
+        auto end = Clock::now();
+        registrationLatencies.push_back(toMicroSeconds(end - begin));
+    }
+
+    for (uint32_t port = 0u; port < NUMBER_OF_PUBLISHERS; ++port)
+    {
+        const iox::capro::ServiceDescription service{static_cast<uint16_t>(port + 1u), 1u, 1u};
+        auto begin = Clock::now();
+        const bool success = createPublisher(*mqInterface, service);
+        auto end = Clock::now();
+        if (!success)
+        {
+            std::cerr << "port creation with the " << protocolName << " protocol failed" << std::endl;
+            return false;
+        }
+        portCreationLatencies.push_back(toMicroSeconds(end - begin));
+    }
+
+    printResult(protocolName, "registration", registrationLatencies);
+    printResult(protocolName, "CREATE_PUBLISHER", portCreationLatencies);
+    return true;
+}
+
+int main()
+{
+    iox::log::LogManager::GetLogManager().SetDefaultLogLevel(iox::log::LogLevel::kError);
+
+    iox::RouDiConfig_t defaultRouDiConfig = iox::RouDiConfig_t().setDefaults();
+    iox::roudi::IceOryxRouDiComponents roudiComponents(defaultRouDiConfig);
+
+    // the application is not monitored and must not be killed since it is this process
+    iox::roudi::RouDi roudi(
+        roudiComponents.m_rouDiMemoryManager, roudiComponents.m_portManager, iox::config::MonitoringMode::OFF, false);
+
+    std::cout << "Round trip latency of the requests to RouDi in us" << std::endl;
+    std::cout << "protocol |          request |  samples |      min |      median |      mean" << std::endl;
+
+    int result = EXIT_SUCCESS;
+    if (!measureProtocol(iox::runtime::MqProtocol::TEXT, "text")
+        || !measureProtocol(iox::runtime::MqProtocol::BINARY, "binary"))
+    {
+        result = EXIT_FAILURE;
+    }
+
+    return result;
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi_environment/roudi_environment.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_utils/cxx/convert.hpp"
+#include "iceoryx_utils/log/logmanager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace iox::units::duration_literals;
+
+/// every fake runtime opens a message queue, the default limits of the message queues of a user allow a few hundred
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIMES{100u};
+
+using Clock = std::chrono::steady_clock;
+
+/// @brief sends a text request like the runtime does and checks the type of the answer
+bool sendRequest(iox::runtime::MqRuntimeInterface& mqInterface,
+                 const iox::runtime::MqMessage& request,
+                 const iox::runtime::MqMessageType expectedAnswer)
+{
+    iox::runtime::MqMessage answer;
+    return mqInterface.sendRequestToRouDi(request, answer) && answer.getNumberOfElements() > 0u
+           && iox::runtime::stringToMqMessageType(answer.getElementAtIndex(0).c_str()) == expectedAnswer;
+}
+
+/// @brief the requests of a runtime at its startup: the registration, a publisher, a subscriber and a findService
+/// @return false if a request failed
+bool startFakeRuntime(const std::string& appName, const uint16_t serviceId)
+{
+    iox::runtime::MqRuntimeInterface mqInterface(iox::MQ_ROUDI_NAME, appName, 10_s, iox::runtime::MqProtocol::TEXT);
+    if (mqInterface.getShmTopicSize() == 0u)
+    {
+        return false;
+    }
+
+    const iox::capro::ServiceDescription service{serviceId, 1u, 1u};
+    const std::string serializedService = static_cast<iox::cxx::Serialization>(service).toString();
+    const std::string serializedPortConfigInfo =
+        static_cast<iox::cxx::Serialization>(iox::runtime::PortConfigInfo()).toString();
+
+    iox::runtime::MqMessage createPublisher;
+    createPublisher << iox::runtime::mqMessageTypeToString(iox::runtime::MqMessageType::CREATE_PUBLISHER) << appName
+                    << serializedService << std::to_string(0u) << "" << serializedPortConfigInfo;
+
+    iox::runtime::MqMessage createSubscriber;
+    createSubscriber << iox::runtime::mqMessageTypeToString(iox::runtime::MqMessageType::CREATE_SUBSCRIBER) << appName
+                     << serializedService << std::to_string(0u) << "" << serializedPortConfigInfo;
+
+    iox::runtime::MqMessage findService;
+    findService << iox::runtime::mqMessageTypeToString(iox::runtime::MqMessageType::FIND_SERVICE) << appName
+                << serializedService;
+    iox::runtime::MqMessage instances;
+
+    return sendRequest(mqInterface, createPublisher, iox::runtime::MqMessageType::CREATE_PUBLISHER_ACK)
+           && sendRequest(mqInterface, createSubscriber, iox::runtime::MqMessageType::CREATE_SUBSCRIBER_ACK)
+           && mqInterface.sendRequestToRouDi(findService, instances);
+}
+
+/// @brief all runtimes start at the same time like after the boot of a system
+/// @return the wall clock time in ms until all runtimes are started, a negative value if a runtime failed
+double measureStartupInMilliSeconds(const uint32_t numberOfRuntimes, const uint32_t numberOfMqWorkerThreads)
+{
+    iox::roudi::RouDiEnvironment roudiEnvironment(iox::RouDiConfig_t().setDefaults(),
+                                                  iox::config::MonitoringMode::OFF,
+                                                  0u,
+                                                  numberOfMqWorkerThreads);
+    iox::log::LogManager::GetLogManager().SetDefaultLogLevel(iox::log::LogLevel::kError);
+
+    std::mutex startMutex;
+    std::condition_variable startCondition;
+    bool start{false};
+    std::atomic<uint32_t> numberOfFailedRuntimes{0u};
+
+    std::vector<std::thread> runtimes;
+    for (uint32_t i = 0u; i < numberOfRuntimes; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            {
+                std::unique_lock<std::mutex> lock(startMutex);
+                startCondition.wait(lock, [&] { return start; });
+            }
+            if (!startFakeRuntime("/iox-bm-registration-" + std::to_string(i), static_cast<uint16_t>(i + 1u)))
+            {
+                ++numberOfFailedRuntimes;
+            }
+        });
+    }
+
+    auto begin = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(startMutex);
+        start = true;
+    }
+    startCondition.notify_all();
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+    auto end = Clock::now();
+
+    const double milliSeconds =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()) / 1000.0;
+    return (numberOfFailedRuntimes == 0u) ? milliSeconds : -1.0;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t numberOfRuntimes{DEFAULT_NUMBER_OF_RUNTIMES};
+    if (argc > 1 && (!iox::cxx::convert::fromString(argv[1], numberOfRuntimes) || numberOfRuntimes == 0u))
+    {
+        std::cerr << "usage: " << argv[0] << " [number of runtimes]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    numberOfRuntimes = std::min(numberOfRuntimes, iox::MAX_PROCESS_NUMBER - 1u);
+
+    std::vector<uint32_t> workerThreads{1u, 2u, iox::ROUDI_MQ_WORKER_THREADS};
+    workerThreads.erase(std::unique(workerThreads.begin(), workerThreads.end()), workerThreads.end());
+    std::vector<double> startups;
+    for (auto numberOfMqWorkerThreads : workerThreads)
+    {
+        startups.push_back(measureStartupInMilliSeconds(numberOfRuntimes, numberOfMqWorkerThreads));
+    }
+
+    // RouDi prints its startup, therefore the results are printed at the end
+    std::cout << "Startup of " << numberOfRuntimes << " runtimes at the same time in ms" << std::endl;
+    std::cout << "RouDi MQ worker threads |  startup" << std::endl;
+
+    int result = EXIT_SUCCESS;
+    for (size_t i = 0u; i < workerThreads.size(); ++i)
+    {
+        if (startups[i] < 0.0)
+        {
+            std::cerr << "not all runtimes could be started with " << workerThreads[i] << " worker threads"
+                      << std::endl;
+            result = EXIT_FAILURE;
+            continue;
+        }
+        std::cout << std::setw(23) << workerThreads[i] << " | " << std::setw(8) << std::fixed << std::setprecision(2)
+                  << startups[i] << std::endl;
+    }
+
+    return result;
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/receiver_port.hpp"
+#include "iceoryx_posh/internal/popo/sender_port.hpp"
+#include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/log/logmanager.hpp"
+#include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+constexpr char PROCESS_NAME[]{"/iox-bm-roudi-startup"};
+constexpr uint32_t RECEIVERS_PER_SENDER{2u};
+/// RouDi acquires sender ports for the introspection
+constexpr uint32_t NUMBER_OF_INTROSPECTION_SENDERS{3u};
+
+/// @brief a discovery storm like at the startup of a system, all processes acquire their ports and subscribe resp.
+/// offer at the same time, RouDi handles everything with one discovery run
+/// @return the wall clock time in ms for the acquisition of the ports and the discovery, a negative value if not all
+/// receivers are subscribed
+double measureStartupInMilliSeconds(iox::roudi::PortManager& portManager,
+                                    iox::mepoo::MemoryManager* const payloadMemoryManager,
+                                    const uint32_t numberOfSenders)
+{
+    std::vector<iox::popo::SenderPort> senders;
+    std::vector<iox::popo::ReceiverPort> receivers;
+    senders.reserve(numberOfSenders);
+    receivers.reserve(numberOfSenders * RECEIVERS_PER_SENDER);
+
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0u; i < numberOfSenders; ++i)
+    {
+        const iox::capro::ServiceDescription service{static_cast<uint16_t>(i + 1u), 1u, 1u};
+        for (uint32_t r = 0u; r < RECEIVERS_PER_SENDER; ++r)
+        {
+            receivers.emplace_back(portManager.acquireReceiverPortData(service, PROCESS_NAME));
+            receivers.back().subscribe(true);
+        }
+        senders.emplace_back(
+            portManager.acquireSenderPortData(service, PROCESS_NAME, payloadMemoryManager).get_value());
+        senders.back().activate();
+    }
+    portManager.doDiscovery();
+    auto end = std::chrono::steady_clock::now();
+
+    const bool allSubscribed = std::all_of(
+        receivers.begin(), receivers.end(), [](iox::popo::ReceiverPort& receiver) { return receiver.isSubscribed(); });
+
+    portManager.deletePortsOfProcess(PROCESS_NAME);
+
+    const double milliSeconds =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()) / 1000.0;
+    return allSubscribed ? milliSeconds : -1.0;
+}
+
+int main()
+{
+    // the destruction of every port is logged in debug level
+    iox::log::LogManager::GetLogManager().SetDefaultLogLevel(iox::log::LogLevel::kError);
+    iox::popo::internal::setUniqueRouDiId(0u);
+
+    auto config = iox::RouDiConfig_t().setDefaults();
+    iox::roudi::IceOryxRouDiMemoryManager roudiMemoryManager(config);
+    roudiMemoryManager.createAndAnnounceMemory();
+
+    auto user = iox::posix::PosixGroup::getGroupOfCurrentProcess().getName();
+    auto payloadMemoryManager =
+        roudiMemoryManager.segmentManager().value()->getSegmentInformationForUser(user).m_memoryManager;
+
+    int result = EXIT_SUCCESS;
+    {
+        iox::roudi::PortManager portManager(&roudiMemoryManager);
+        portManager.stopPortIntrospection();
+
+        const uint32_t maxNumberOfSenders = std::min(iox::MAX_PUBLISHERS - NUMBER_OF_INTROSPECTION_SENDERS,
+                                                     iox::MAX_SUBSCRIBERS / RECEIVERS_PER_SENDER);
+
+        std::cout << "Startup of senders with " << RECEIVERS_PER_SENDER
+                  << " receivers each, acquisition and discovery in one RouDi cycle" << std::endl;
+        std::cout << "   senders | receivers | startup [ms] | per port [us]" << std::endl;
+        std::vector<uint32_t> numbersOfSenders{16u, 32u, 64u, 128u, 256u, 512u};
+        numbersOfSenders.push_back(maxNumberOfSenders);
+        for (auto numberOfSenders : numbersOfSenders)
+        {
+            if (numberOfSenders > maxNumberOfSenders)
+            {
+                continue;
+            }
+
+            auto milliSeconds = measureStartupInMilliSeconds(portManager, payloadMemoryManager, numberOfSenders);
+            if (milliSeconds < 0.0)
+            {
+                std::cerr << "not all receivers are subscribed with " << numberOfSenders << " senders" << std::endl;
+                result = EXIT_FAILURE;
+                continue;
+            }
+
+            const uint32_t numberOfPorts = numberOfSenders * (1u + RECEIVERS_PER_SENDER);
+            std::cout << std::setw(10) << numberOfSenders << " | " << std::setw(9)
+                      << numberOfSenders * RECEIVERS_PER_SENDER << " | " << std::setw(12) << std::fixed
+                      << std::setprecision(2) << milliSeconds << " | " << std::setw(13)
+                      << milliSeconds * 1000.0 / numberOfPorts << std::endl;
+        }
+
+        portManager.deletePortsOfProcess(iox::MQ_ROUDI_NAME);
+    }
+
+    iox::RelativePointer::unregisterAll();
+    iox::popo::internal::unsetUniqueRouDiId();
+
+    return result;
+}
@@ -13,46 +13,130 @@
 // limitations under the License.
 #include "base.hpp"
 
+#include <algorithm>
+
+constexpr uint32_t IcePerfBase::ONE_KILOBYTE;
+constexpr uint32_t IcePerfBase::MAX_NUMBER_OF_FOLLOWERS;
+constexpr uint32_t IcePerfBase::MAX_BURST_SIZE;
+constexpr uint64_t IcePerfBase::MAX_BURST_SIZE_IN_BYTES;
+
+double ThroughputResult::getMessagesPerSecond() const noexcept
+{
+    return (duration.count() == 0) ? 0.0 : static_cast<double>(numberOfMessages) * 1e9 / duration.count();
+}
+
+double ThroughputResult::getGigabytesPerSecond() const noexcept
+{
+    return (duration.count() == 0) ? 0.0 : static_cast<double>(numberOfBytes) / duration.count();
+}
 
 void IcePerfBase::prePingPongLeader(uint32_t payloadSizeInBytes) noexcept
 {
-    sendPerfTopic(payloadSizeInBytes, true);
+    sendPerfTopic(PerfTopic(payloadSizeInBytes, PerfTopicType::PING));
 }
 
 void IcePerfBase::postPingPongLeader() noexcept
 {
-    // Wait for the last response
-    receivePerfTopic();
+    // Wait for the last responses
+    for (uint32_t i = 0U; i < m_numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
 
     std::cout << "done" << std::endl;
 }
 
 void IcePerfBase::releaseFollower() noexcept
 {
-    sendPerfTopic(sizeof(PerfTopic), false);
+    PerfTopic perfTopic(sizeof(PerfTopic), PerfTopicType::DATA);
+    perfTopic.run = false;
+    sendPerfTopic(perfTopic);
 }
 
-double IcePerfBase::pingPongLeader(int64_t numRoundTrips) noexcept
+LatencyHistogram IcePerfBase::pingPongLeader(int64_t numRoundTrips) noexcept
 {
-    auto start = std::chrono::high_resolution_clock::now();
+    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+    LatencyHistogram latencies;
 
-    // run the performance test
+    // run the performance test, every round trip is timed separately to see the spikes which an average would hide
+    auto start = std::chrono::steady_clock::now();
     for (auto i = 0U; i < numRoundTrips; ++i)
     {
-        auto perfTopic = receivePerfTopic();
-        sendPerfTopic(perfTopic.payloadSize, true);
+        PerfTopic perfTopic;
+        for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+        {
+            perfTopic = receivePerfTopic();
+        }
+        sendPerfTopic(PerfTopic(perfTopic.payloadSize, PerfTopicType::PING));
+
+        auto finish = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
+        latencies.record(static_cast<uint64_t>(duration.count()) / TRANSMISSIONS_PER_ROUNDTRIP);
+        start = finish;
+    }
+
+    return latencies;
+}
+
+ThroughputResult IcePerfBase::throughputLeader(const std::vector<uint32_t>& payloadSizesInBytes,
+                                               int64_t numMessages) noexcept
+{
+    ThroughputResult result;
+    const uint32_t messagesPerBurst =
+        burstSize(*std::max_element(payloadSizesInBytes.begin(), payloadSizesInBytes.end()));
+
+    auto start = std::chrono::steady_clock::now();
+    auto payloadSize = payloadSizesInBytes.begin();
+    while (result.numberOfMessages < static_cast<uint64_t>(numMessages))
+    {
+        // every burst is acknowledged by all followers, this limits the messages in flight without a round trip per
+        // message
+        const uint64_t remainingMessages = static_cast<uint64_t>(numMessages) - result.numberOfMessages;
+        const uint64_t messagesInThisBurst = std::min(static_cast<uint64_t>(messagesPerBurst), remainingMessages);
+        for (uint64_t i = 1U; i <= messagesInThisBurst; ++i)
+        {
+            const auto type = (i == messagesInThisBurst) ? PerfTopicType::LAST_DATA : PerfTopicType::DATA;
+            sendPerfTopic(PerfTopic(*payloadSize, type));
+            result.numberOfBytes += *payloadSize;
+            if (++payloadSize == payloadSizesInBytes.end())
+            {
+                payloadSize = payloadSizesInBytes.begin();
+            }
+        }
+        result.numberOfMessages += messagesInThisBurst;
+
+        for (uint32_t follower = 0U; follower < m_numberOfFollowers; ++follower)
+        {
+            receivePerfTopic();
+        }
     }
+    result.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
 
-    auto finish = std::chrono::high_resolution_clock::now();
+    return result;
+}
 
-    constexpr int64_t TRANSMISSIONS_PER_ROUNDTRIP{2};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds = (duration.count() / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    auto latencyInMicroSeconds = static_cast<double>(latencyInNanoSeconds) / 1000;
-    return latencyInMicroSeconds;
+ThroughputResult IcePerfBase::manyToOneLeader(uint32_t payloadSizeInBytes, int64_t numMessages) noexcept
+{
+    ThroughputResult result;
+    // the bursts of all followers together must not be larger than the burst of a single sender
+    const uint32_t messagesPerBurst = std::max(burstSize(payloadSizeInBytes) / m_numberOfFollowers, 1U);
+
+    auto start = std::chrono::steady_clock::now();
+    while (result.numberOfMessages < static_cast<uint64_t>(numMessages))
+    {
+        sendPerfTopic(PerfTopic(sizeof(PerfTopic), PerfTopicType::SEND_BURST, messagesPerBurst, payloadSizeInBytes));
+        for (uint32_t i = 0U; i < messagesPerBurst * m_numberOfFollowers; ++i)
+        {
+            result.numberOfBytes += receivePerfTopic().payloadSize;
+        }
+        result.numberOfMessages += messagesPerBurst * m_numberOfFollowers;
+    }
+    result.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    return result;
 }
 
-void IcePerfBase::pingPongFollower() noexcept
+void IcePerfBase::followLeader() noexcept
 {
     while (true)
     {
@@ -64,6 +148,29 @@ void IcePerfBase::pingPongFollower() noexcept
             break;
         }
 
-        sendPerfTopic(perfTopic.payloadSize, true);
+        switch (perfTopic.type)
+        {
+        case PerfTopicType::PING:
+            sendPerfTopic(PerfTopic(perfTopic.payloadSize, PerfTopicType::PING));
+            break;
+        case PerfTopicType::DATA:
+            break;
+        case PerfTopicType::LAST_DATA:
+            sendPerfTopic(PerfTopic(sizeof(PerfTopic), PerfTopicType::DATA));
+            break;
+        case PerfTopicType::SEND_BURST:
+            for (uint32_t i = 0U; i < perfTopic.burstSize; ++i)
+            {
+                sendPerfTopic(PerfTopic(perfTopic.burstPayloadSize, PerfTopicType::DATA));
+            }
+            break;
+        }
     }
 }
+
+uint32_t IcePerfBase::burstSize(uint32_t payloadSizeInBytes) noexcept
+{
+    const uint64_t burstSize = MAX_BURST_SIZE_IN_BYTES / std::max(payloadSizeInBytes, 1U);
+    return static_cast<uint32_t>(std::min(std::max(burstSize, static_cast<uint64_t>(1U)),
+                                          static_cast<uint64_t>(MAX_BURST_SIZE)));
+}
@@ -14,26 +14,58 @@
 #ifndef IOX_EXAMPLES_ICEPERF_BASE_HPP
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
+#include "latency_histogram.hpp"
 #include "topic_data.hpp"
 #include <chrono>
 #include <iostream>
+#include <vector>
+
+struct ThroughputResult
+{
+    uint64_t numberOfMessages{0U};
+    uint64_t numberOfBytes{0U};
+    std::chrono::nanoseconds duration{0};
+
+    double getMessagesPerSecond() const noexcept;
+    double getGigabytesPerSecond() const noexcept;
+};
 
 class IcePerfBase
 {
   public:
     static constexpr uint32_t ONE_KILOBYTE = 1024U;
-    virtual void initLeader() noexcept = 0;
+    /// @brief the bursts of all followers of a many-to-one measurement must fit into the iceoryx subscriber queue
+    static constexpr uint32_t MAX_NUMBER_OF_FOLLOWERS = 64U;
+    /// @brief number of messages in flight before the sender waits for the receiver in the throughput measurements
+    static constexpr uint32_t MAX_BURST_SIZE = 64U;
+    /// @brief limits the bursts of large payloads to not run out of chunks in the default mempool configuration
+    static constexpr uint64_t MAX_BURST_SIZE_IN_BYTES = 8U * ONE_KILOBYTE * ONE_KILOBYTE;
+
+    /// @brief sets up the communication and waits until the given number of followers registered
+    virtual void initLeader(uint32_t numberOfFollowers) noexcept = 0;
     virtual void initFollower() noexcept = 0;
     virtual void shutdown() noexcept = 0;
 
     void prePingPongLeader(uint32_t payloadSizeInBytes) noexcept;
     void postPingPongLeader() noexcept;
     void releaseFollower() noexcept;
-    double pingPongLeader(int64_t numRoundTrips) noexcept;
-    void pingPongFollower() noexcept;
+    /// @brief does the given number of round trips with the followers and returns the histogram of the one-way
+    /// latencies, which are half of the measured round trip times. With more than one follower a round trip ends
+    /// with the answer of the slowest follower.
+    LatencyHistogram pingPongLeader(int64_t numRoundTrips) noexcept;
+    /// @brief sends the given number of messages in bursts to all followers, the payload sizes are used in turn
+    ThroughputResult throughputLeader(const std::vector<uint32_t>& payloadSizesInBytes, int64_t numMessages) noexcept;
+    /// @brief lets all followers send bursts to the leader until the given number of messages was received
+    ThroughputResult manyToOneLeader(uint32_t payloadSizeInBytes, int64_t numMessages) noexcept;
+    /// @brief answers the requests of the leader until it is released
+    void followLeader() noexcept;
+
+  protected:
+    uint32_t m_numberOfFollowers{1U};
 
   private:
-    virtual void sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept = 0;
+    static uint32_t burstSize(uint32_t payloadSizeInBytes) noexcept;
+    virtual void sendPerfTopic(const PerfTopic& perfTopic) noexcept = 0;
     virtual PerfTopic receivePerfTopic() noexcept = 0;
 };
 
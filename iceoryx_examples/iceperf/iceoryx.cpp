@@ -16,26 +16,76 @@
 
 #include <chrono>
 
-Iceoryx::Iceoryx(const iox::capro::IdString& publisherName, const iox::capro::IdString& subscriberName) noexcept
+constexpr uint64_t IceoryxWaitSettings::DEFAULT_SPIN_ITERATIONS;
+constexpr uint64_t IceoryxWaitSettings::DEFAULT_YIELD_ITERATIONS;
+constexpr uint32_t Iceoryx::WAIT_FOR_CHUNK_TIMEOUT_MS;
+
+namespace
+{
+const char* const ICEORYX_WAIT_NAMES[] = {"poll", "block", "spin"};
+}
+
+bool IceoryxWaitSettings::setWaitFromString(const std::string& name) noexcept
+{
+    for (uint32_t i = 0U; i <= static_cast<uint32_t>(IceoryxWait::SPIN); ++i)
+    {
+        if (name == ICEORYX_WAIT_NAMES[i])
+        {
+            wait = static_cast<IceoryxWait>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string IceoryxWaitSettings::getWaitName() const noexcept
+{
+    return ICEORYX_WAIT_NAMES[static_cast<uint32_t>(wait)];
+}
+
+Iceoryx::Iceoryx(const iox::capro::IdString& publisherName,
+                 const iox::capro::IdString& subscriberName,
+                 const IceoryxWaitSettings& waitSettings) noexcept
     : m_publisher({"Comedians", publisherName, "Duo"})
     , m_subscriber({"Comedians", subscriberName, "Duo"})
+    , m_waitSettings(waitSettings)
 {
 }
 
-void Iceoryx::initLeader() noexcept
+void Iceoryx::initLeader(uint32_t numberOfFollowers) noexcept
 {
+    m_numberOfFollowers = numberOfFollowers;
     init();
+
+    // the subscription of one follower does not tell anything about the others
+    std::cout << "Waiting for " << numberOfFollowers << " follower(s) ... " << std::endl << std::flush;
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
 }
 
 void Iceoryx::initFollower() noexcept
 {
     init();
+
+    sendPerfTopic(PerfTopic(sizeof(PerfTopic), PerfTopicType::DATA));
 }
 
 void Iceoryx::init() noexcept
 {
     m_publisher.offer();
     m_subscriber.subscribe();
+    if (m_waitSettings.wait != IceoryxWait::POLL)
+    {
+        // the sender posts the semaphore of the subscriber only when it is set as receive semaphore
+        m_subscriber.setChunkReceiveSemaphore(m_subscriber.getSemaphore());
+    }
+    if (m_waitSettings.wait == IceoryxWait::SPIN)
+    {
+        m_subscriber.setWaitStrategy(
+            iox::popo::WaitStrategy(m_waitSettings.spinIterations, m_waitSettings.yieldIterations));
+    }
 
     std::cout << "Waiting till subscribed ... " << std::endl << std::flush;
     while (m_subscriber.getSubscriptionState() != iox::popo::SubscriptionState::SUBSCRIBED)
@@ -52,6 +102,10 @@ void Iceoryx::init() noexcept
 
 void Iceoryx::shutdown() noexcept
 {
+    if (m_waitSettings.wait != IceoryxWait::POLL)
+    {
+        m_subscriber.unsetChunkReceiveSemaphore();
+    }
     m_subscriber.unsubscribe();
 
     std::cout << "Waiting for subscriber to unsubscribe ... " << std::endl << std::flush;
@@ -66,11 +120,10 @@ void Iceoryx::shutdown() noexcept
     std::cout << "Finished!" << std::endl;
 }
 
-void Iceoryx::sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept
+void Iceoryx::sendPerfTopic(const PerfTopic& perfTopic) noexcept
 {
-    auto sendSample = static_cast<PerfTopic*>(m_publisher.allocateChunk(payloadSizeInBytes, true));
-    sendSample->payloadSize = payloadSizeInBytes;
-    sendSample->run = runFlag;
+    auto sendSample = static_cast<PerfTopic*>(m_publisher.allocateChunk(perfTopic.payloadSize, true));
+    *sendSample = perfTopic;
     sendSample->subPackets = 1;
 
     m_publisher.sendChunk(sendSample);
@@ -81,7 +134,13 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
     const void* receivedChunk;
     while (!m_subscriber.getChunk(&receivedChunk))
     {
-        // poll as fast as possible
+        if (m_waitSettings.wait != IceoryxWait::POLL)
+        {
+            // the semaphore is posted for every chunk, also for the ones which were taken without waiting, so a
+            // wake up does not guarantee a chunk and we just try again
+            m_subscriber.waitForChunk(WAIT_FOR_CHUNK_TIMEOUT_MS);
+        }
+        // otherwise poll as fast as possible
     }
 
     auto receivedSample = *(static_cast<const PerfTopic*>(receivedChunk));
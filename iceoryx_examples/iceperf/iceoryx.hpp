@@ -18,22 +18,57 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
+
+#include <string>
+
+/// @brief How the iceoryx subscriber waits for the next sample
+enum class IceoryxWait : uint32_t
+{
+    /// @brief busy polling of the subscriber without ever blocking
+    POLL,
+    /// @brief blocking on the semaphore of the subscriber right away
+    BLOCK,
+    /// @brief polling with a WaitStrategy before blocking on the semaphore
+    SPIN
+};
+
+struct IceoryxWaitSettings
+{
+    static constexpr uint64_t DEFAULT_SPIN_ITERATIONS{10000U};
+    static constexpr uint64_t DEFAULT_YIELD_ITERATIONS{100U};
+
+    /// @brief sets the wait from its name on the command line
+    /// @return false if the name is none of 'poll', 'block' and 'spin'
+    bool setWaitFromString(const std::string& name) noexcept;
+    /// @brief the name of the wait, e.g. to label the results
+    std::string getWaitName() const noexcept;
+
+    IceoryxWait wait{IceoryxWait::POLL};
+    uint64_t spinIterations{DEFAULT_SPIN_ITERATIONS};
+    uint64_t yieldIterations{DEFAULT_YIELD_ITERATIONS};
+};
 
 class Iceoryx : public IcePerfBase
 {
   public:
-    Iceoryx(const iox::capro::IdString& publisherName, const iox::capro::IdString& subscriberName) noexcept;
-    void initLeader() noexcept override;
+    Iceoryx(const iox::capro::IdString& publisherName,
+            const iox::capro::IdString& subscriberName,
+            const IceoryxWaitSettings& waitSettings = IceoryxWaitSettings()) noexcept;
+    void initLeader(uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
+    static constexpr uint32_t WAIT_FOR_CHUNK_TIMEOUT_MS{100U};
+
     void init() noexcept;
-    void sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept override;
+    void sendPerfTopic(const PerfTopic& perfTopic) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     iox::popo::Publisher m_publisher;
     iox::popo::Subscriber m_subscriber;
+    IceoryxWaitSettings m_waitSettings;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_ICEORYX_HPP
@@ -16,12 +16,15 @@
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_utils/cxx/convert.hpp"
+#include "iceoryx_utils/platform/getopt.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
 
 #include <chrono>
 #include <iostream>
+#include <string>
 
 constexpr char APP_NAME[] = "/hardy";
 constexpr char PUBLISHER[] = "Hardy";
@@ -31,27 +34,94 @@ void followerDo(IcePerfBase& ipcTechnology)
 {
     ipcTechnology.initFollower();
 
-    ipcTechnology.pingPongFollower();
+    ipcTechnology.followLeader();
 
     ipcTechnology.shutdown();
 }
 
-int main()
+int main(int argc, char* argv[])
 {
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"index", required_argument, nullptr, 'i'},
+                                      {"wait", required_argument, nullptr, 'w'},
+                                      {"spin-iterations", required_argument, nullptr, 's'},
+                                      {"yield-iterations", required_argument, nullptr, 'y'},
+                                      {nullptr, 0, nullptr, 0}};
+    constexpr const char* shortOptions = "hi:w:s:y:";
+
+    // every follower needs its own channel from the leader when there is more than one
+    uint32_t followerIndex{0U};
+    IceoryxWaitSettings iceoryxWait;
+    int32_t index;
+    int32_t opt{-1};
+    while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
+    {
+        switch (opt)
+        {
+        case 'i':
+            if (!iox::cxx::convert::fromString(optarg, followerIndex))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        case 'w':
+            if (!iceoryxWait.setWaitFromString(optarg))
+            {
+                std::cout << "Options for wait are 'poll', 'block' and 'spin'!" << std::endl;
+                exit(1);
+            }
+            break;
+        case 's':
+            if (!iox::cxx::convert::fromString(optarg, iceoryxWait.spinIterations))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        case 'y':
+            if (!iox::cxx::convert::fromString(optarg, iceoryxWait.yieldIterations))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        default:
+            std::cout << "Usage: " << argv[0] << " [options]" << std::endl;
+            std::cout << "Options:" << std::endl;
+            std::cout << "-h, --help                        Display help." << std::endl;
+            std::cout << "-i, --index <INT>                 Set the index of this follower, starting at 0, default = 0."
+                      << std::endl;
+            std::cout << "-w, --wait <WAIT>                 Set how the iceoryx subscriber waits for samples."
+                      << std::endl;
+            std::cout << "                                  <WAIT> {poll, block, spin}, default = 'poll'" << std::endl;
+            std::cout << "                                  poll: busy polling without blocking" << std::endl;
+            std::cout << "                                  block: blocking on the semaphore right away" << std::endl;
+            std::cout << "                                  spin: spinning and yielding before blocking" << std::endl;
+            std::cout << "-s, --spin-iterations <INT>       Set the spin iterations of 'spin', default = "
+                      << IceoryxWaitSettings::DEFAULT_SPIN_ITERATIONS << "." << std::endl;
+            std::cout << "-y, --yield-iterations <INT>      Set the yield iterations of 'spin', default = "
+                      << IceoryxWaitSettings::DEFAULT_YIELD_ITERATIONS << "." << std::endl;
+            exit((opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    const std::string subscriber = SUBSCRIBER + std::to_string(followerIndex);
+
 #ifndef __APPLE__
-    MQ mq("/" + std::string(PUBLISHER), "/" + std::string(SUBSCRIBER));
+    MQ mq("/" + std::string(PUBLISHER), "/" + subscriber);
     std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
     followerDo(mq);
     std::this_thread::sleep_for(std::chrono::milliseconds(3000)); // ensure leader first
 #endif
 
     std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
-    UDS uds("/tmp/" + std::string(PUBLISHER), "/tmp/" + std::string(SUBSCRIBER));
+    UDS uds("/tmp/" + std::string(PUBLISHER), "/tmp/" + subscriber);
     followerDo(uds);
 
     std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
-    iox::runtime::PoshRuntime::getInstance(APP_NAME); // runtime for registering with the RouDi daemon
-    Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
+    // runtime for registering with the RouDi daemon
+    iox::runtime::PoshRuntime::getInstance(std::string(APP_NAME) + std::to_string(followerIndex));
+    Iceoryx iceoryx(PUBLISHER, SUBSCRIBER, iceoryxWait);
     followerDo(iceoryx);
 
     return (EXIT_SUCCESS);
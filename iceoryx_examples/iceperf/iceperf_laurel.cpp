@@ -15,86 +15,395 @@
 #include "iceoryx.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
+#include "iceoryx_utils/platform/getopt.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
 
 #include <chrono>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
 
 constexpr int64_t NUMBER_OF_ROUNDTRIPS{10000};
 constexpr char APP_NAME[] = "/laurel";
 constexpr char PUBLISHER[] = "Laurel";
 constexpr char SUBSCRIBER[] = "Hardy";
 
+const std::vector<uint32_t> PAYLOAD_SIZES_IN_KB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
+/// mostly small messages and from time to time a large one, like the load of a typical production system
+const std::vector<uint32_t> MIXED_PAYLOAD_SIZES_IN_KB{1, 1, 16, 1, 1, 128, 1, 1, 16, 1,
+                                                      1, 1024, 1, 1, 16, 1, 1, 128, 1, 16};
 
-void leaderDo(IcePerfBase& ipcTechnology, int64_t numRoundtrips)
+enum class Mode
 {
-    ipcTechnology.initLeader();
+    LATENCY,
+    THROUGHPUT,
+    MIXED,
+    MANY_TO_ONE
+};
 
-    std::vector<double> latencyInMicroSeconds;
-    const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
-    for (const auto payloadSizeInKB : payloadSizesInKB)
+const char* MODE_NAMES[] = {"latency", "throughput", "mixed", "many-to-one"};
+
+struct Settings
+{
+    Mode mode{Mode::LATENCY};
+    uint64_t numberOfMessages{NUMBER_OF_ROUNDTRIPS};
+    uint32_t numberOfFollowers{1U};
+    IceoryxWaitSettings iceoryxWait;
+};
+
+struct MeasurementResult
+{
+    std::string technology;
+    double payloadSizeInKB;
+    LatencyHistogram latencies;
+    ThroughputResult throughput;
+};
+
+void printResults(const std::vector<MeasurementResult>& results, const Settings& settings)
+{
+    std::cout << std::endl;
+    std::cout << "#### Measurement Result ####" << std::endl;
+    if (settings.mode == Mode::LATENCY)
+    {
+        std::cout << settings.numberOfMessages << " round trips for each payload with "
+                  << settings.numberOfFollowers << " follower(s)." << std::endl;
+        std::cout << std::endl;
+        std::cout << "| Payload Size [kB] | Average Latency [µs] "
+                  << "|  p50 [µs] |  p90 [µs] |  p99 [µs] | p99.9 [µs] |  max [µs] |" << std::endl;
+        std::cout << "|------------------:|---------------------:"
+                  << "|----------:|----------:|----------:|-----------:|----------:|" << std::endl;
+        for (const auto& result : results)
+        {
+            const auto& latencies = result.latencies;
+            std::cout << "| " << std::setw(17) << result.payloadSizeInKB << " | " << std::setw(20)
+                      << std::setprecision(2) << latencies.getAverageInMicroseconds() << " | " << std::setw(9)
+                      << latencies.getPercentileInMicroseconds(50.0) << " | " << std::setw(9)
+                      << latencies.getPercentileInMicroseconds(90.0) << " | " << std::setw(9)
+                      << latencies.getPercentileInMicroseconds(99.0) << " | " << std::setw(10)
+                      << latencies.getPercentileInMicroseconds(99.9) << " | " << std::setw(9)
+                      << latencies.getMaxInMicroseconds() << " |" << std::endl;
+        }
+    }
+    else
+    {
+        std::cout << settings.numberOfMessages << " messages for each payload in "
+                  << MODE_NAMES[static_cast<uint32_t>(settings.mode)] << " mode with " << settings.numberOfFollowers
+                  << " follower(s)." << std::endl;
+        std::cout << std::endl;
+        std::cout << "| Payload Size [kB] | Messages/s [1/s] | Throughput [GB/s] |" << std::endl;
+        std::cout << "|------------------:|-----------------:|------------------:|" << std::endl;
+        for (const auto& result : results)
+        {
+            std::cout << "| " << std::setw(17) << std::setprecision(4) << result.payloadSizeInKB << " | "
+                      << std::setw(16) << std::setprecision(3) << result.throughput.getMessagesPerSecond() << " | "
+                      << std::setw(17) << result.throughput.getGigabytesPerSecond() << " |" << std::endl;
+        }
+    }
+
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+}
+
+std::vector<MeasurementResult>
+leaderDo(IcePerfBase& ipcTechnology, const std::string& technology, const Settings& settings)
+{
+    ipcTechnology.initLeader(settings.numberOfFollowers);
+
+    std::vector<MeasurementResult> results;
+    if (settings.mode == Mode::MIXED)
+    {
+        std::cout << "Measurement for mixed payload ... " << std::flush;
+        std::vector<uint32_t> payloadSizesInBytes;
+        for (const auto payloadSizeInKB : MIXED_PAYLOAD_SIZES_IN_KB)
+        {
+            payloadSizesInBytes.push_back(payloadSizeInKB * IcePerfBase::ONE_KILOBYTE);
+        }
+        auto averagePayloadSizeInKB =
+            static_cast<double>(std::accumulate(MIXED_PAYLOAD_SIZES_IN_KB.begin(), MIXED_PAYLOAD_SIZES_IN_KB.end(), 0U))
+            / MIXED_PAYLOAD_SIZES_IN_KB.size();
+
+        auto throughput = ipcTechnology.throughputLeader(payloadSizesInBytes, settings.numberOfMessages);
+
+        results.push_back({technology, averagePayloadSizeInKB, LatencyHistogram(), throughput});
+        std::cout << "done" << std::endl;
+    }
+    else
     {
-        std::cout << "Measurement for " << payloadSizeInKB << " kB payload ... " << std::flush;
-        auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
+        for (const auto payloadSizeInKB : PAYLOAD_SIZES_IN_KB)
+        {
+            std::cout << "Measurement for " << payloadSizeInKB << " kB payload ... " << std::flush;
+            auto payloadSizeInBytes = payloadSizeInKB * IcePerfBase::ONE_KILOBYTE;
 
-        ipcTechnology.prePingPongLeader(payloadSizeInBytes);
+            MeasurementResult result{technology, static_cast<double>(payloadSizeInKB), LatencyHistogram(), {}};
+            switch (settings.mode)
+            {
+            case Mode::LATENCY:
+                ipcTechnology.prePingPongLeader(payloadSizeInBytes);
 
-        auto latency = ipcTechnology.pingPongLeader(numRoundtrips);
+                result.latencies = ipcTechnology.pingPongLeader(settings.numberOfMessages);
 
-        latencyInMicroSeconds.push_back(latency);
+                ipcTechnology.postPingPongLeader();
+                break;
+            case Mode::THROUGHPUT:
+                result.throughput = ipcTechnology.throughputLeader({payloadSizeInBytes}, settings.numberOfMessages);
+                std::cout << "done" << std::endl;
+                break;
+            case Mode::MANY_TO_ONE:
+                result.throughput = ipcTechnology.manyToOneLeader(payloadSizeInBytes, settings.numberOfMessages);
+                std::cout << "done" << std::endl;
+                break;
+            case Mode::MIXED:
+                break;
+            }
 
-        ipcTechnology.postPingPongLeader();
+            results.push_back(std::move(result));
+        }
     }
 
     ipcTechnology.releaseFollower();
 
     ipcTechnology.shutdown();
 
-    std::cout << std::endl;
-    std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << numRoundtrips << " round trips for each payload." << std::endl;
-    std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (size_t i = 0; i < latencyInMicroSeconds.size(); ++i)
+    printResults(results, settings);
+
+    return results;
+}
+
+void writeCsv(const std::string& fileName, const std::vector<MeasurementResult>& results, const Settings& settings)
+{
+    std::ofstream file(fileName);
+    file << "technology,mode,numberOfFollowers,payloadSizeInKB,numberOfMessages,";
+    if (settings.mode == Mode::LATENCY)
     {
-        std::cout << "| " << std::setw(17) << payloadSizesInKB.at(i) << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroSeconds.at(i) << " |" << std::endl;
+        file << "averageInMicroseconds,p50InMicroseconds,p90InMicroseconds,p99InMicroseconds,p99.9InMicroseconds,"
+                "maxInMicroseconds"
+             << std::endl;
+    }
+    else
+    {
+        file << "messagesPerSecond,gigabytesPerSecond" << std::endl;
     }
 
-    std::cout << std::endl;
-    std::cout << "Finished!" << std::endl;
+    for (const auto& result : results)
+    {
+        file << result.technology << "," << MODE_NAMES[static_cast<uint32_t>(settings.mode)] << ","
+             << settings.numberOfFollowers << "," << result.payloadSizeInKB << "," << settings.numberOfMessages << ",";
+        if (settings.mode == Mode::LATENCY)
+        {
+            const auto& latencies = result.latencies;
+            file << latencies.getAverageInMicroseconds() << "," << latencies.getPercentileInMicroseconds(50.0) << ","
+                 << latencies.getPercentileInMicroseconds(90.0) << "," << latencies.getPercentileInMicroseconds(99.0)
+                 << "," << latencies.getPercentileInMicroseconds(99.9) << "," << latencies.getMaxInMicroseconds()
+                 << std::endl;
+        }
+        else
+        {
+            file << result.throughput.getMessagesPerSecond() << "," << result.throughput.getGigabytesPerSecond()
+                 << std::endl;
+        }
+    }
+}
+
+void writeJson(const std::string& fileName, const std::vector<MeasurementResult>& results, const Settings& settings)
+{
+    std::ofstream file(fileName);
+    file << "{" << std::endl;
+    file << "  \"mode\": \"" << MODE_NAMES[static_cast<uint32_t>(settings.mode)] << "\"," << std::endl;
+    file << "  \"numberOfFollowers\": " << settings.numberOfFollowers << "," << std::endl;
+    file << "  \"numberOfMessages\": " << settings.numberOfMessages << "," << std::endl;
+    file << "  \"results\": [" << std::endl;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        file << "    {\"technology\": \"" << results[i].technology << "\""
+             << ", \"payloadSizeInKB\": " << results[i].payloadSizeInKB;
+        if (settings.mode == Mode::LATENCY)
+        {
+            const auto& latencies = results[i].latencies;
+            file << ", \"averageInMicroseconds\": " << latencies.getAverageInMicroseconds()
+                 << ", \"p50InMicroseconds\": " << latencies.getPercentileInMicroseconds(50.0)
+                 << ", \"p90InMicroseconds\": " << latencies.getPercentileInMicroseconds(90.0)
+                 << ", \"p99InMicroseconds\": " << latencies.getPercentileInMicroseconds(99.0)
+                 << ", \"p99.9InMicroseconds\": " << latencies.getPercentileInMicroseconds(99.9)
+                 << ", \"maxInMicroseconds\": " << latencies.getMaxInMicroseconds();
+        }
+        else
+        {
+            file << ", \"messagesPerSecond\": " << results[i].throughput.getMessagesPerSecond()
+                 << ", \"gigabytesPerSecond\": " << results[i].throughput.getGigabytesPerSecond();
+        }
+        file << "}" << ((i + 1 < results.size()) ? "," : "") << std::endl;
+    }
+    file << "  ]" << std::endl;
+    file << "}" << std::endl;
 }
 
 int main(int argc, char* argv[])
 {
-    uint64_t numRoundtrips = NUMBER_OF_ROUNDTRIPS;
-    if (argc > 1)
+    constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                      {"number-of-roundtrips", required_argument, nullptr, 'n'},
+                                      {"mode", required_argument, nullptr, 'm'},
+                                      {"number-of-followers", required_argument, nullptr, 'f'},
+                                      {"csv", required_argument, nullptr, 'c'},
+                                      {"json", required_argument, nullptr, 'j'},
+                                      {"wait", required_argument, nullptr, 'w'},
+                                      {"spin-iterations", required_argument, nullptr, 's'},
+                                      {"yield-iterations", required_argument, nullptr, 'y'},
+                                      {nullptr, 0, nullptr, 0}};
+    constexpr const char* shortOptions = "hn:m:f:c:j:w:s:y:";
+
+    Settings settings;
+    std::string csvFileName;
+    std::string jsonFileName;
+    int32_t index;
+    int32_t opt{-1};
+    while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
     {
-        if (!iox::cxx::convert::fromString(argv[1], numRoundtrips))
+        switch (opt)
+        {
+        case 'n':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfMessages))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        case 'm':
+        {
+            bool isKnownMode{false};
+            for (uint32_t mode = 0U; mode <= static_cast<uint32_t>(Mode::MANY_TO_ONE); ++mode)
+            {
+                if (strcmp(optarg, MODE_NAMES[mode]) == 0)
+                {
+                    settings.mode = static_cast<Mode>(mode);
+                    isKnownMode = true;
+                }
+            }
+            if (!isKnownMode)
+            {
+                std::cout << "Options for mode are 'latency', 'throughput', 'mixed' and 'many-to-one'!" << std::endl;
+                exit(1);
+            }
+            break;
+        }
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.numberOfFollowers) || settings.numberOfFollowers == 0U
+                || settings.numberOfFollowers > IcePerfBase::MAX_NUMBER_OF_FOLLOWERS)
+            {
+                std::cout << "The number of followers must be in the range of [1, "
+                          << IcePerfBase::MAX_NUMBER_OF_FOLLOWERS << "]" << std::endl;
+                exit(1);
+            }
+            break;
+        case 'c':
+            csvFileName = optarg;
+            break;
+        case 'j':
+            jsonFileName = optarg;
+            break;
+        case 'w':
+            if (!settings.iceoryxWait.setWaitFromString(optarg))
+            {
+                std::cout << "Options for wait are 'poll', 'block' and 'spin'!" << std::endl;
+                exit(1);
+            }
+            break;
+        case 's':
+            if (!iox::cxx::convert::fromString(optarg, settings.iceoryxWait.spinIterations))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        case 'y':
+            if (!iox::cxx::convert::fromString(optarg, settings.iceoryxWait.yieldIterations))
+            {
+                std::cout << "error command line parameter" << std::endl;
+                exit(1);
+            }
+            break;
+        default:
+            std::cout << "Usage: " << argv[0] << " [options] [number of round trips]" << std::endl;
+            std::cout << "Options:" << std::endl;
+            std::cout << "-h, --help                        Display help." << std::endl;
+            std::cout << "-n, --number-of-roundtrips <INT>  Set the number of round trips or messages for each payload"
+                      << std::endl;
+            std::cout << "                                  size." << std::endl;
+            std::cout << "-m, --mode <MODE>                 Set the measurement." << std::endl;
+            std::cout << "                                  <MODE> {latency, throughput, mixed, many-to-one}"
+                      << std::endl;
+            std::cout << "                                  default = 'latency'" << std::endl;
+            std::cout << "                                  latency: ping pong round trips with the followers"
+                      << std::endl;
+            std::cout << "                                  throughput: one-way messages to the followers" << std::endl;
+            std::cout << "                                  mixed: throughput with a mix of payload sizes" << std::endl;
+            std::cout << "                                  many-to-one: one-way messages from the followers"
+                      << std::endl;
+            std::cout << "-f, --number-of-followers <INT>   Set the number of iceperf-hardy processes, default = 1."
+                      << std::endl;
+            std::cout << "-c, --csv <FILE>                  Write the results as CSV to <FILE>." << std::endl;
+            std::cout << "-j, --json <FILE>                 Write the results as JSON to <FILE>." << std::endl;
+            std::cout << "-w, --wait <WAIT>                 Set how the iceoryx subscriber waits for samples."
+                      << std::endl;
+            std::cout << "                                  <WAIT> {poll, block, spin}, default = 'poll'" << std::endl;
+            std::cout << "                                  poll: busy polling without blocking" << std::endl;
+            std::cout << "                                  block: blocking on the semaphore right away" << std::endl;
+            std::cout << "                                  spin: spinning and yielding before blocking" << std::endl;
+            std::cout << "-s, --spin-iterations <INT>       Set the spin iterations of 'spin', default = "
+                      << IceoryxWaitSettings::DEFAULT_SPIN_ITERATIONS << "." << std::endl;
+            std::cout << "-y, --yield-iterations <INT>      Set the yield iterations of 'spin', default = "
+                      << IceoryxWaitSettings::DEFAULT_YIELD_ITERATIONS << "." << std::endl;
+            exit((opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+
+    // the number of round trips can also be given without option like in former versions
+    if (optind < argc)
+    {
+        if (!iox::cxx::convert::fromString(argv[optind], settings.numberOfMessages))
         {
             std::cout << "error command line parameter" << std::endl;
             exit(1);
         }
     }
 
+    std::vector<MeasurementResult> results;
+    auto appendResults = [&](std::vector<MeasurementResult>&& technologyResults) {
+        std::move(technologyResults.begin(), technologyResults.end(), std::back_inserter(results));
+    };
+
 #ifndef __APPLE__
     std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
     MQ mq("/" + std::string(PUBLISHER), "/" + std::string(SUBSCRIBER));
-    leaderDo(mq, numRoundtrips);
+    appendResults(leaderDo(mq, "mq", settings));
 #endif
 
     std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
     UDS uds("/tmp/" + std::string(PUBLISHER), "/tmp/" + std::string(SUBSCRIBER));
-    leaderDo(uds, numRoundtrips);
+    appendResults(leaderDo(uds, "uds", settings));
 
     std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
     iox::runtime::PoshRuntime::getInstance(APP_NAME); // runtime for registering with the RouDi daemon
-    Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-    leaderDo(iceoryx, numRoundtrips);
+    Iceoryx iceoryx(PUBLISHER, SUBSCRIBER, settings.iceoryxWait);
+    // the wait is part of the technology to compare the results of different waits
+    const std::string iceoryxTechnology = (settings.iceoryxWait.wait == IceoryxWait::POLL)
+                                              ? "iceoryx"
+                                              : "iceoryx-" + settings.iceoryxWait.getWaitName();
+    appendResults(leaderDo(iceoryx, iceoryxTechnology, settings));
+
+    if (!csvFileName.empty())
+    {
+        writeCsv(csvFileName, results, settings);
+    }
+    if (!jsonFileName.empty())
+    {
+        writeJson(jsonFileName, results, settings);
+    }
 
     return (EXIT_SUCCESS);
 }
@@ -0,0 +1,107 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_COUNT;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_HALF_COUNT;
+constexpr uint32_t LatencyHistogram::MAX_VALUE_BITS;
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : m_buckets(SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1U) * SUB_BUCKET_HALF_COUNT, 0U)
+{
+}
+
+void LatencyHistogram::record(const uint64_t latencyInNanoseconds) noexcept
+{
+    ++m_buckets[bucketIndex(latencyInNanoseconds)];
+    ++m_count;
+    m_sumInNanoseconds += latencyInNanoseconds;
+    m_maxInNanoseconds = std::max(m_maxInNanoseconds, latencyInNanoseconds);
+}
+
+uint64_t LatencyHistogram::getCount() const noexcept
+{
+    return m_count;
+}
+
+double LatencyHistogram::getAverageInMicroseconds() const noexcept
+{
+    return (m_count == 0U) ? 0.0 : static_cast<double>(m_sumInNanoseconds) / static_cast<double>(m_count) / 1000.0;
+}
+
+double LatencyHistogram::getMaxInMicroseconds() const noexcept
+{
+    return static_cast<double>(m_maxInNanoseconds) / 1000.0;
+}
+
+double LatencyHistogram::getPercentileInMicroseconds(const double percentage) const noexcept
+{
+    if (m_count == 0U)
+    {
+        return 0.0;
+    }
+
+    // the rank of the latency in the sorted list of all recorded latencies
+    auto rank = static_cast<uint64_t>(std::ceil(percentage / 100.0 * static_cast<double>(m_count)));
+    rank = std::min(std::max(rank, static_cast<uint64_t>(1U)), m_count);
+
+    uint64_t countSoFar{0U};
+    for (uint32_t index = 0U; index < m_buckets.size(); ++index)
+    {
+        countSoFar += m_buckets[index];
+        if (countSoFar >= rank)
+        {
+            // the upper bound of the bucket may be above the largest latency which was really recorded
+            return static_cast<double>(std::min(highestEquivalentValue(index), m_maxInNanoseconds)) / 1000.0;
+        }
+    }
+    return getMaxInMicroseconds();
+}
+
+uint32_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    if (latencyInNanoseconds < SUB_BUCKET_COUNT)
+    {
+        return static_cast<uint32_t>(latencyInNanoseconds);
+    }
+
+    constexpr uint64_t MAX_VALUE = (static_cast<uint64_t>(1U) << MAX_VALUE_BITS) - 1U;
+    const uint64_t value = std::min(latencyInNanoseconds, MAX_VALUE);
+
+    // shift the value until it fits into the upper half of the sub buckets, the shift is the resolution of the bucket
+    uint32_t shift = 0U;
+    while ((value >> shift) >= SUB_BUCKET_COUNT)
+    {
+        ++shift;
+    }
+    return static_cast<uint32_t>(SUB_BUCKET_COUNT + (shift - 1U) * SUB_BUCKET_HALF_COUNT
+                                 + ((value >> shift) - SUB_BUCKET_HALF_COUNT));
+}
+
+uint64_t LatencyHistogram::highestEquivalentValue(const uint32_t index) noexcept
+{
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    const uint32_t shift = (index - static_cast<uint32_t>(SUB_BUCKET_COUNT)) / SUB_BUCKET_HALF_COUNT + 1U;
+    const uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT + SUB_BUCKET_HALF_COUNT;
+    return ((subBucket + 1U) << shift) - 1U;
+}
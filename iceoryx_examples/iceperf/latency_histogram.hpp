@@ -0,0 +1,54 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+#define IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+
+#include <cstdint>
+#include <vector>
+
+/// @brief HDR style histogram for the latencies of the single round trips. Latencies below SUB_BUCKET_COUNT
+/// nanoseconds are counted exactly, above that every power of two is divided into SUB_BUCKET_COUNT / 2 linear sub
+/// buckets. This keeps the relative error of a percentile below 1/64 (~1.6%) for the whole range while the memory
+/// stays constant and recording a latency is only a few instructions.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 7U;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1U << SUB_BUCKET_BITS;
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2U;
+    /// @brief larger latencies (~18 minutes) are counted in the last bucket
+    static constexpr uint32_t MAX_VALUE_BITS = 40U;
+
+    LatencyHistogram() noexcept;
+
+    void record(const uint64_t latencyInNanoseconds) noexcept;
+
+    uint64_t getCount() const noexcept;
+    double getAverageInMicroseconds() const noexcept;
+    double getMaxInMicroseconds() const noexcept;
+    /// @brief returns the latency which is not exceeded by the given percentage of the recorded latencies, e.g.
+    /// getPercentileInMicroseconds(99.9) for p99.9
+    double getPercentileInMicroseconds(const double percentage) const noexcept;
+
+  private:
+    static uint32_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+    static uint64_t highestEquivalentValue(const uint32_t index) noexcept;
+
+    std::vector<uint64_t> m_buckets;
+    uint64_t m_count{0U};
+    uint64_t m_sumInNanoseconds{0U};
+    uint64_t m_maxInNanoseconds{0U};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
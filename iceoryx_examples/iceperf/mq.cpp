@@ -26,17 +26,24 @@ MQ::MQ(const std::string& publisherName, const std::string& subscriberName) noex
 {
 }
 
-void MQ::initLeader() noexcept
+void MQ::initLeader(uint32_t numberOfFollowers) noexcept
 {
+    m_numberOfFollowers = numberOfFollowers;
     init();
 
     open(m_subscriberName, iox::posix::IpcChannelSide::SERVER);
 
-    std::cout << "waiting for follower" << std::endl;
+    std::cout << "waiting for " << numberOfFollowers << " follower(s)" << std::endl;
 
-    receivePerfTopic();
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
 
-    open(m_publisherName, iox::posix::IpcChannelSide::CLIENT);
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        open(m_publisherName + std::to_string(i), iox::posix::IpcChannelSide::CLIENT);
+    }
 }
 
 void MQ::initFollower() noexcept
@@ -50,7 +57,7 @@ void MQ::initFollower() noexcept
 
     open(m_publisherName, iox::posix::IpcChannelSide::CLIENT);
 
-    sendPerfTopic(sizeof(PerfTopic), true);
+    sendPerfTopic(PerfTopic(sizeof(PerfTopic), PerfTopicType::DATA));
 }
 
 void MQ::init() noexcept
@@ -87,24 +94,28 @@ void MQ::shutdown() noexcept
         exit(1);
     }
 
-    auto mqCallPubClose = iox::cxx::makeSmartC(
-        mq_close, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {ERROR_CODE}, {}, m_mqDescriptorPublisher);
-
-    if (mqCallPubClose.hasErrors())
+    for (auto mqDescriptorPublisher : m_mqDescriptorPublishers)
     {
-        std::cout << "mq_close error" << std::endl;
-        exit(1);
+        auto mqCallPubClose = iox::cxx::makeSmartC(
+            mq_close, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {ERROR_CODE}, {}, mqDescriptorPublisher);
+
+        if (mqCallPubClose.hasErrors())
+        {
+            std::cout << "mq_close error" << std::endl;
+            exit(1);
+        }
     }
+    m_mqDescriptorPublishers.clear();
 }
 
-void MQ::sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept
+void MQ::sendPerfTopic(const PerfTopic& perfTopic) noexcept
 {
+    const uint32_t payloadSizeInBytes = perfTopic.payloadSize;
     char* buffer = new char[payloadSizeInBytes];
     auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
 
     // Specify the payload size for the measurement
-    sample->payloadSize = payloadSizeInBytes;
-    sample->run = runFlag;
+    *sample = perfTopic;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
@@ -180,25 +191,29 @@ void MQ::open(const std::string& name, const iox::posix::IpcChannelSide channelS
     }
     else
     {
-        m_mqDescriptorPublisher = mqCall.getReturnValue();
+        m_mqDescriptorPublishers.push_back(mqCall.getReturnValue());
     }
 }
 
 void MQ::send(const char* buffer, uint32_t length) noexcept
 {
-    auto mqCall = iox::cxx::makeSmartC(mq_send,
-                                       iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
-                                       {ERROR_CODE},
-                                       {},
-                                       m_mqDescriptorPublisher,
-                                       buffer,
-                                       length,
-                                       1);
-
-    if (mqCall.hasErrors())
+    // without a shared medium every follower gets its own copy
+    for (auto mqDescriptorPublisher : m_mqDescriptorPublishers)
     {
-        std::cout << std::endl << "send error" << std::endl;
-        exit(1);
+        auto mqCall = iox::cxx::makeSmartC(mq_send,
+                                           iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                           {ERROR_CODE},
+                                           {},
+                                           mqDescriptorPublisher,
+                                           buffer,
+                                           length,
+                                           1);
+
+        if (mqCall.hasErrors())
+        {
+            std::cout << std::endl << "send error" << std::endl;
+            exit(1);
+        }
     }
 }
 
@@ -26,6 +26,7 @@
 #include "iceoryx_utils/platform/stat.hpp"
 
 #include <string>
+#include <vector>
 
 class MQ : public IcePerfBase
 {
@@ -36,7 +37,8 @@ class MQ : public IcePerfBase
     static constexpr mqd_t INVALID_DESCRIPTOR = -1;
 
     MQ(const std::string& publisherName, const std::string& subscriberName) noexcept;
-    void initLeader() noexcept override;
+    /// @brief the leader sends to the message queues of the followers, which are named publisherName + follower index
+    void initLeader(uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
@@ -45,13 +47,13 @@ class MQ : public IcePerfBase
     void open(const std::string& name, const iox::posix::IpcChannelSide channelSide) noexcept;
     void send(const char* buffer, uint32_t length) noexcept;
     void receive(char* buffer) noexcept;
-    void sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept override;
+    void sendPerfTopic(const PerfTopic& perfTopic) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     const std::string m_publisherName;
     const std::string m_subscriberName;
     struct mq_attr m_attributes;
-    mqd_t m_mqDescriptorPublisher = INVALID_DESCRIPTOR;
+    std::vector<mqd_t> m_mqDescriptorPublishers;
     mqd_t m_mqDescriptorSubscriber = INVALID_DESCRIPTOR;
     // read/write permissions
     static constexpr mode_t m_filemode{S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH};
@@ -16,10 +16,38 @@
 
 #include <cstdint>
 
+/// @brief tells the follower how to react on a PerfTopic
+enum class PerfTopicType : uint32_t
+{
+    /// the follower answers with a PerfTopic of the same payload size
+    PING,
+    /// the follower does not answer
+    DATA,
+    /// ends a burst of DATA, the follower answers with a small acknowledge
+    LAST_DATA,
+    /// the follower sends burstSize DATA with burstPayloadSize to the leader
+    SEND_BURST
+};
+
 struct PerfTopic
 {
+    PerfTopic() noexcept = default;
+    PerfTopic(uint32_t payloadSizeInBytes,
+              PerfTopicType topicType,
+              uint32_t numberOfBurstMessages = 0U,
+              uint32_t burstPayloadSizeInBytes = 0U) noexcept
+        : payloadSize(payloadSizeInBytes)
+        , type(topicType)
+        , burstSize(numberOfBurstMessages)
+        , burstPayloadSize(burstPayloadSizeInBytes)
+    {
+    }
+
     uint32_t payloadSize{0};
     uint32_t subPackets{0};
+    PerfTopicType type{PerfTopicType::PING};
+    uint32_t burstSize{0};
+    uint32_t burstPayloadSize{0};
     bool run{true};
 };
 
@@ -23,31 +23,36 @@ UDS::UDS(const std::string& publisherName, const std::string& subscriberName) no
 {
 }
 
-void UDS::initLeader() noexcept
+void UDS::initLeader(uint32_t numberOfFollowers) noexcept
 {
+    m_numberOfFollowers = numberOfFollowers;
     init();
 
-    std::cout << "waiting for follower" << std::endl;
+    std::cout << "waiting for " << numberOfFollowers << " follower(s)" << std::endl;
 
-    receivePerfTopic();
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
+
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        addPublisherAddress(m_publisherName + std::to_string(i));
+    }
 }
 
 void UDS::initFollower() noexcept
 {
     init();
+    addPublisherAddress(m_publisherName);
 
     std::cout << "registering with the leader, if no leader this will crash with a socket error now" << std::endl;
 
-    sendPerfTopic(sizeof(PerfTopic), true);
+    sendPerfTopic(PerfTopic(sizeof(PerfTopic), PerfTopicType::DATA));
 }
 
 void UDS::init() noexcept
 {
-    // initialize the sockAddr data structure with the provided name
-    memset(&m_sockAddrPublisher, 0, sizeof(m_sockAddrPublisher));
-    m_sockAddrPublisher.sun_family = AF_LOCAL;
-    strncpy(m_sockAddrPublisher.sun_path, m_publisherName.c_str(), m_publisherName.size());
-
     auto socketCallPublisher = iox::cxx::makeSmartC(
         socket, iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE, {ERROR_CODE}, {}, AF_LOCAL, SOCK_DGRAM, 0);
 
@@ -99,6 +104,16 @@ void UDS::init() noexcept
     }
 }
 
+void UDS::addPublisherAddress(const std::string& name) noexcept
+{
+    // initialize the sockAddr data structure with the provided name
+    struct sockaddr_un sockAddrPublisher;
+    memset(&sockAddrPublisher, 0, sizeof(sockAddrPublisher));
+    sockAddrPublisher.sun_family = AF_LOCAL;
+    strncpy(sockAddrPublisher.sun_path, name.c_str(), name.size());
+    m_sockAddrPublishers.push_back(sockAddrPublisher);
+}
+
 void UDS::shutdown() noexcept
 {
     if (m_sockfdPublisher != INVALID_FD)
@@ -138,14 +153,14 @@ void UDS::shutdown() noexcept
     }
 }
 
-void UDS::sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept
+void UDS::sendPerfTopic(const PerfTopic& perfTopic) noexcept
 {
+    const uint32_t payloadSizeInBytes = perfTopic.payloadSize;
     char* buffer = new char[payloadSizeInBytes];
     auto sample = reinterpret_cast<PerfTopic*>(&buffer[0]);
 
     // Specify the payload size for the measurement
-    sample->payloadSize = payloadSizeInBytes;
-    sample->run = runFlag;
+    *sample = perfTopic;
     if (payloadSizeInBytes <= MAX_MESSAGE_SIZE)
     {
         sample->subPackets = 1;
@@ -181,21 +196,25 @@ PerfTopic UDS::receivePerfTopic() noexcept
 
 void UDS::send(const char* buffer, uint32_t length) noexcept
 {
-    auto sendCall = iox::cxx::makeSmartC(sendto,
-                                         iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
-                                         {ERROR_CODE},
-                                         {},
-                                         m_sockfdPublisher,
-                                         buffer,
-                                         length,
-                                         static_cast<int>(0),
-                                         reinterpret_cast<struct sockaddr*>(&m_sockAddrPublisher),
-                                         static_cast<socklen_t>(sizeof(m_sockAddrPublisher)));
-
-    if (sendCall.hasErrors())
+    // without a shared medium every follower gets its own copy
+    for (auto& sockAddrPublisher : m_sockAddrPublishers)
     {
-        std::cout << std::endl << "send error" << std::endl;
-        exit(1);
+        auto sendCall = iox::cxx::makeSmartC(sendto,
+                                             iox::cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
+                                             {ERROR_CODE},
+                                             {},
+                                             m_sockfdPublisher,
+                                             buffer,
+                                             length,
+                                             static_cast<int>(0),
+                                             reinterpret_cast<struct sockaddr*>(&sockAddrPublisher),
+                                             static_cast<socklen_t>(sizeof(sockAddrPublisher)));
+
+        if (sendCall.hasErrors())
+        {
+            std::cout << std::endl << "send error" << std::endl;
+            exit(1);
+        }
     }
 }
 
@@ -24,6 +24,7 @@
 #include "iceoryx_utils/platform/unistd.hpp"
 
 #include <string>
+#include <vector>
 
 class UDS : public IcePerfBase
 {
@@ -40,22 +41,24 @@ class UDS : public IcePerfBase
     static constexpr int32_t INVALID_FD = -1;
 
     UDS(const std::string& publisherName, const std::string& subscriberName) noexcept;
-    void initLeader() noexcept override;
+    /// @brief the leader sends to the sockets of the followers, which are named publisherName + follower index
+    void initLeader(uint32_t numberOfFollowers) noexcept override;
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
   private:
     void init() noexcept;
+    void addPublisherAddress(const std::string& name) noexcept;
     void send(const char* buffer, uint32_t length) noexcept;
     void receive(char* buffer) noexcept;
-    void sendPerfTopic(uint32_t payloadSizeInBytes, bool runFlag) noexcept override;
+    void sendPerfTopic(const PerfTopic& perfTopic) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
     const std::string m_publisherName;
     const std::string m_subscriberName;
     int m_sockfdPublisher{INVALID_FD};
     int m_sockfdSubscriber{INVALID_FD};
-    struct sockaddr_un m_sockAddrPublisher;
+    std::vector<struct sockaddr_un> m_sockAddrPublishers;
     struct sockaddr_un m_sockAddrSubscriber;
     char m_message[MAX_MESSAGE_SIZE];
 };
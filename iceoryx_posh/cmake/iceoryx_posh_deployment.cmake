@@ -4,6 +4,13 @@ if(ONE_TO_MANY_ONLY)
      set(IOX_COMMUNICATION_POLICY OneToManyPolicy)
 endif(ONE_TO_MANY_ONLY)
 
+if(BINARY_MQ_PROTOCOL)
+     message("[i] Using the binary protocol for the requests to RouDi!")
+     set(IOX_BINARY_MQ_PROTOCOL true)
+else()
+     set(IOX_BINARY_MQ_PROTOCOL false)
+endif(BINARY_MQ_PROTOCOL)
+
 if(NOT IOX_COMMUNICATION_POLICY)
     set(IOX_COMMUNICATION_POLICY ManyToManyPolicy)
 endif()
@@ -28,6 +35,10 @@ if(NOT IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY)
     set(IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY 8)
 endif()
 
+if(NOT IOX_MAX_CHUNKS_IN_PUBLISHER_MAGAZINE)
+    set(IOX_MAX_CHUNKS_IN_PUBLISHER_MAGAZINE 0)
+endif()
+
 if(NOT IOX_MAX_PUBLISHER_HISTORY)
     set(IOX_MAX_PUBLISHER_HISTORY 16)
 endif()
@@ -152,7 +152,11 @@ class ServiceDescription
     // @brief Set this service description to be is used for an RouDi-internal channel
     void setInternal() noexcept;
     /// @brief Returns the scope of a ServiceDescription
-    Scope getScope() noexcept;
+    Scope getScope() const noexcept;
+    /// @brief Sets the scope of a ServiceDescription
+    void setScope(const Scope scope) noexcept;
+    /// @brief Marks the ServiceDescription as service only description, like the constructors without event do
+    void setServiceOnlyDescription() noexcept;
 
     ///@{
     /// Getters for the integer and string IDs
@@ -74,8 +74,15 @@ using namespace units::duration_literals;
 // Timeout
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 60_s;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief interval of the full discovery of all ports, in between RouDi only handles the kinds of ports which notified
+/// the discovery trigger; the full discovery catches changes whose notification got lost, e.g. when an application
+/// terminated between the change of a port and the notification
+constexpr units::Duration FULL_DISCOVERY_INTERVAL = 10 * DISCOVERY_INTERVAL; // >= DISCOVERY_INTERVAL
 constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * DISCOVERY_INTERVAL;         // > DISCOVERY_INTERVAL
 constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
+/// @brief interval in which a ChunkDistributor which waits for an ongoing lock-free delivery checks whether the
+/// sending process is still alive
+constexpr units::Duration CHUNK_DISTRIBUTOR_SENDER_LIVENESS_CHECK_INTERVAL = 10_ms;
 
 /// @todo remove MAX_RECEIVERS_PER_SENDERPORT when the new port building blocks are used
 constexpr uint32_t MAX_RECEIVERS_PER_SENDERPORT = build::IOX_MAX_SUBSCRIBERS_PER_PUBLISHER;
@@ -86,6 +93,8 @@ constexpr uint32_t MAX_PUBLISHERS = build::IOX_MAX_PUBLISHERS;
 constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PER_PUBLISHER;
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
+/// number of chunks a publisher caches in front of the mempools, 0 disables the cache
+constexpr uint32_t MAX_CHUNKS_IN_PUBLISHER_MAGAZINE = build::IOX_MAX_CHUNKS_IN_PUBLISHER_MAGAZINE;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
@@ -133,7 +142,13 @@ constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
 constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+/// number of RouDi threads which receive and process the requests of the applications concurrently
+constexpr uint32_t ROUDI_MQ_WORKER_THREADS = 4U;
 
+// Introspection
+/// number of buckets of the latency histograms of the ports; bucket 0 counts the latencies below 1 us, bucket i the
+/// latencies in [2^(i-1) us, 2^i us) and the last bucket all larger latencies
+constexpr uint32_t NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS = 16U;
 
 // Processes
 constexpr uint32_t MAX_PROCESS_NUMBER = 300U;
@@ -0,0 +1,59 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_MEPOO_CHUNK_RELEASER_HPP
+#define IOX_POSH_MEPOO_CHUNK_RELEASER_HPP
+
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Releases many chunks at once, e.g. when a queue is cleared or the chunks of a terminated process are
+/// reclaimed. The chunks whose last owner is gone are collected and handed back to their mempools in batches,
+/// which needs a single operation on the free list of a mempool per batch instead of one per chunk.
+/// @note Like SharedChunk, the ChunkReleaser is not thread safe. Collected chunks are lost if the process is
+/// terminated before they are flushed.
+class ChunkReleaser
+{
+  public:
+    ChunkReleaser() = default;
+    ChunkReleaser(const ChunkReleaser&) = delete;
+    ChunkReleaser(ChunkReleaser&&) = delete;
+    ChunkReleaser& operator=(const ChunkReleaser&) = delete;
+    ChunkReleaser& operator=(ChunkReleaser&&) = delete;
+
+    /// @brief flushes the collected chunks
+    ~ChunkReleaser();
+
+    /// @brief drops the ownership of f_chunk; if this was the last owner, the chunk is collected and handed back to
+    /// its mempool with the next flush
+    void release(SharedChunk&& f_chunk);
+
+    /// @brief hands back all collected chunks to their mempools
+    void flush();
+
+  private:
+    ChunkManagement* m_chunkManagements[MemPool::MAX_CHUNKS_PER_BATCH];
+    uint32_t m_numberOfChunks{0u};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_RELEASER_HPP
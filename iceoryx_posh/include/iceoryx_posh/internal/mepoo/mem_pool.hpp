@@ -29,17 +29,24 @@ namespace mepoo
 {
 struct MemPoolInfo
 {
-    MemPoolInfo(uint32_t f_usedChunks, uint32_t f_minFreeChunks, uint32_t f_numChunks, uint32_t f_chunkSize)
+    MemPoolInfo(uint32_t f_usedChunks,
+                uint32_t f_minFreeChunks,
+                uint32_t f_numChunks,
+                uint32_t f_chunkSize,
+                uint32_t f_spilledChunks = 0u)
         : m_usedChunks(f_usedChunks)
         , m_minFreeChunks(f_minFreeChunks)
         , m_numChunks(f_numChunks)
         , m_chunkSize(f_chunkSize)
+        , m_spilledChunks(f_spilledChunks)
     {
     }
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    /// number of chunks which were requested from this mempool but were served by a larger one
+    uint32_t m_spilledChunks{0};
 };
 
 class MemPool
@@ -47,6 +54,8 @@ class MemPool
   public:
     using freeList_t = concurrent::LoFFLi;
     static constexpr uint64_t MEMORY_ALIGNMENT = posix::Allocator::MEMORY_ALIGNMENT;
+    /// @brief the maximum number of chunks which are taken from or handed back to the free list in one operation
+    static constexpr uint32_t MAX_CHUNKS_PER_BATCH{64u};
 
     MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunkSize,
             const cxx::greater_or_equal<uint32_t, 1> f_numberOfChunks,
@@ -59,16 +68,41 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk();
+    /// @brief acquires a chunk like getChunk but without reporting an exhausted mempool, e.g. when the caller can still
+    /// fall back to another mempool
+    /// @return the chunk or a nullptr if the mempool is exhausted
+    void* tryGetChunk();
+    /// @brief acquires up to f_numberOfChunks chunks at once without reporting an exhausted mempool
+    /// @param[out] f_chunks storage for the acquired chunks, must have room for f_numberOfChunks entries
+    /// @return the number of acquired chunks
+    uint32_t getChunks(void** const f_chunks, const uint32_t f_numberOfChunks);
     uint32_t getChunkSize() const;
     uint32_t getChunkCount() const;
     uint32_t getUsedChunks() const;
     uint32_t getMinFree() const;
+    uint32_t getSpilledChunks() const;
     MemPoolInfo getInfo() const;
 
+    /// @brief records that chunks from this mempool were requested but a larger mempool was used since this one
+    /// was exhausted
+    /// @param[in] f_numberOfChunks number of spilled chunks
+    void recordSpillOver(const uint32_t f_numberOfChunks = 1u);
+
+    /// @brief the number of requests which found this mempool exhausted; chunk caches hand back their cached chunks
+    /// when it changes, so that they become available for the other users of the mempool
+    uint64_t getReclaimRequests() const;
+
     void freeChunk(const void* chunk);
+    /// @brief hands back the chunks to the free list in batches of MAX_CHUNKS_PER_BATCH chunks
+    /// @param[in] f_chunks the chunks to free
+    /// @param[in] f_numberOfChunks number of chunks in f_chunks
+    void freeChunks(const void* const* const f_chunks, const uint32_t f_numberOfChunks);
 
   private:
-    void adjustMinFree();
+    /// @brief lowers the low watermark of free chunks if f_freeChunks is a new minimum
+    void adjustMinFree(const int64_t f_freeChunks);
+    uint32_t usedChunksFromFreeChunks(const int64_t f_freeChunks) const;
+    uint32_t indexOfChunk(const void* chunk) const;
     bool isMultipleOfAlignment(const uint32_t value) const;
 
     relative_ptr<uint8_t> m_rawMemory;
@@ -78,12 +112,21 @@ class MemPool
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0u};
 
-    /// @todo: put this into one struct and in a separate class in concurrent.
-    std::atomic<uint32_t> m_usedChunks{0u};
-    std::atomic<uint32_t> m_minFree{0u};
-    /// @todo: end
+    std::atomic<uint32_t> m_spilledChunks{0u};
 
     freeList_t m_freeIndices;
+    /// the number of chunks in the free list minus the reserved ones; a chunk is reserved before it is taken from the
+    /// free list and counted again after it was handed back, therefore this is never larger than the number of chunks
+    /// in the free list and can become negative when more chunks are requested than available
+    /// @note this is a single counter which is modified with one atomic read-modify-write by every allocation and
+    /// every free, it is declared right behind the free list but no cache line alignment is enforced since the
+    /// mempools are placed in shared memory with an alignment of MEMORY_ALIGNMENT
+    std::atomic<int64_t> m_freeChunks{0};
+    /// conservative low watermark of m_freeChunks, it is only written when a new minimum is reached. Since a freed chunk
+    /// is counted after it was pushed to the free list, a concurrent allocation might see too few free chunks; the
+    /// watermark is therefore never above the real minimum but might be below it by the number of concurrent frees
+    std::atomic<uint32_t> m_minFree{0u};
+    std::atomic<uint64_t> m_reclaimRequests{0u};
 };
 
 } // namespace mepoo
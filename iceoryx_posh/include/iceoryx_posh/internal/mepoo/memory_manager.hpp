@@ -49,7 +49,17 @@ class MemoryManager
                                 posix::Allocator* f_managementAllocator,
                                 posix::Allocator* f_payloadAllocator);
 
-    SharedChunk getChunk(const MaxSize_t f_size);
+    /// @brief acquires a chunk for a payload of f_size bytes, the payload and an optional user-header are placed in
+    /// the chunk according to f_layout
+    /// @return the chunk or an empty SharedChunk if there is no fitting chunk or the layout is invalid
+    SharedChunk getChunk(const MaxSize_t f_size, const ChunkLayout& f_layout = ChunkLayout());
+
+    /// @brief acquires up to f_numberOfChunks chunks from the best fitting mempool in one go, e.g. to refill a chunk
+    /// cache; if it is exhausted the remaining chunks are taken from the configured number of larger mempools like
+    /// getChunk does, there is no error output when all of them are exhausted
+    /// @param[out] f_chunks storage for the acquired chunks, must have room for f_numberOfChunks entries
+    /// @return the number of acquired chunks
+    uint32_t getChunks(const MaxSize_t f_size, SharedChunk* const f_chunks, const uint32_t f_numberOfChunks);
 
     uint32_t getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const;
 
@@ -64,6 +74,30 @@ class MemoryManager
     static uint64_t requiredFullMemorySize(const MePooConfig& f_mePooConfig);
 
   private:
+    /// @brief a size class covers the sizes from 2^(n-1)+1 to 2^n, n being the size class
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{33u};
+    static uint32_t sizeClassOf(const uint32_t f_size) noexcept;
+    /// @brief returns the index of the smallest mempool with a chunk size greater or equal to f_chunkSize or the
+    /// number of mempools if there is none
+    /// @note the mempools of the size class of f_chunkSize are found in O(1), the fitting one among them with a binary
+    /// search. The lookup therefore needs at most log2(n) + 1 comparisons with n being the number of mempools within
+    /// the size class, i.e. a single one for configurations with one mempool per power of two and never more than
+    /// log2(MAX_NUMBER_OF_MEMPOOLS) + 1
+    uint32_t getMemPoolIndexForChunkSize(const uint32_t f_chunkSize) const noexcept;
+    void generateSizeClassLookup() noexcept;
+    /// @brief returns the index of the largest mempool which may serve a request for the mempool at f_index according
+    /// to the spill over policy, f_index must be a valid mempool index
+    uint32_t getLastSpillOverMemPoolIndex(const uint32_t f_index) const noexcept;
+    SharedChunk createSharedChunk(void* const f_chunk,
+                                  MemPool& f_memPool,
+                                  const uint32_t f_payloadSize,
+                                  const ChunkLayout& f_layout);
+    SharedChunk createSharedChunk(void* const f_chunk,
+                                  void* const f_chunkManagement,
+                                  MemPool& f_memPool,
+                                  const uint32_t f_payloadSize,
+                                  const ChunkLayout& f_layout);
+
     void printMemPoolVector() const;
     void addMemPool(posix::Allocator* f_managementAllocator,
                     posix::Allocator* f_payloadAllocator,
@@ -74,9 +108,17 @@ class MemoryManager
   private:
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    uint32_t m_spillOverMemPools{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+
+    /// @brief index of the first mempool which has a chunk size within or above the size class, the last entry is
+    /// the number of mempools. The mempools of size class n are the ones from m_sizeClassLookup[n] to
+    /// m_sizeClassLookup[n + 1], this limits the search for a fitting mempool to the mempools of the same size class
+    uint32_t m_sizeClassLookup[NUMBER_OF_SIZE_CLASSES + 1u]{0u};
+    /// @brief the chunk sizes of the mempools in a contiguous array, the search does not touch the MemPool objects
+    uint32_t m_chunkSizes[MAX_NUMBER_OF_MEMPOOLS]{0u};
 };
 
 } // namespace mepoo
@@ -17,6 +17,7 @@
 #include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_utils/cxx/function_ref.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 namespace iox
@@ -59,6 +60,13 @@ class SharedChunk
 
     bool hasNoOtherOwners() const;
 
+    /// @brief creates f_numberOfOwners additional owners of the chunk with a single increment of the reference
+    /// counter and hands them one after another to f_takeOwner, e.g. to deliver a chunk to many queues without an
+    /// atomic operation per queue
+    /// @param[in] f_numberOfOwners the number of additional owners
+    /// @param[in] f_takeOwner is called f_numberOfOwners times with an additional owner of the chunk
+    void shareWith(const uint64_t f_numberOfOwners, const cxx::function_ref<void(SharedChunk&&)> f_takeOwner) const;
+
     template <typename>
     friend class SharedPointer;
 
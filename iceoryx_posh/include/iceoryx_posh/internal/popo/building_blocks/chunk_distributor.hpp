@@ -41,12 +41,16 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The stored queues are kept in slots of atomic pointers. They are only modified with the lock held but read
+/// lock-free when delivering. A removed queue is only considered unused after the deliveries which might still use it
+/// finished, they are tracked with a reader count per delivery epoch. A sender which was terminated in the middle of a
+/// delivery is detected by checking whether its process is still alive. Without a history, deliverToAllStoredQueues
+/// does not take the lock at all and therefore never contends with tryAddQueue and tryRemoveQueue. With a history the
+/// lock is still taken for sending since a newly added queue must get each chunk exactly once and in order.
 /// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
+/// For the history, a container is used which is not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
-/// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
-/// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
-/// access to the containers. Then a memory synchronization would be sufficient.
+/// threads is in the ChunkDistributor and holds a lock.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
 /// terminated user application. Even if access from middleware and user threads do not overlap, the history
 /// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
@@ -77,7 +81,8 @@ class ChunkDistributor
     cxx::expected<ChunkDistributorError> tryAddQueue(cxx::not_null<ChunkQueueData_t* const> queueToAdd,
                                                      const uint64_t requestedHistory = 0u) noexcept;
 
-    /// @brief Remove a queue from the internal list of chunk queues
+    /// @brief Remove a queue from the internal list of chunk queues. When this call returns, an ongoing lock-free
+    /// delivery does not access the removed queue anymore
     /// @param[in] chunk queue to remove from the list
     /// @return if the queue could be removed it returns success, otherwiese a ChunkDistributor error
     cxx::expected<ChunkDistributorError> tryRemoveQueue(cxx::not_null<ChunkQueueData_t* const> queueToRemove) noexcept;
@@ -124,6 +129,10 @@ class ChunkDistributor
     MemberType_t* getMembers() noexcept;
 
   private:
+    void deliverToStoredQueuesLockFree(const mepoo::SharedChunk& chunk) noexcept;
+    void waitForOngoingDelivery() noexcept;
+    bool isSenderAlive() const noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
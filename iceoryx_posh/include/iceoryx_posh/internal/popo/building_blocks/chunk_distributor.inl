@@ -14,6 +14,12 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_INL
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_INL
 
+#include <cerrno>
+#include <chrono>
+#include <signal.h>
+#include <thread>
+#include <unistd.h>
+
 namespace iox
 {
 namespace popo
@@ -46,42 +52,44 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
-
-    // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    typename MemberType_t::QueueSlot_t* freeSlot{nullptr};
+    for (auto& slot : getMembers()->m_queues)
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        ChunkQueueData_t* const queue = slot;
+        if (queue == queueToAdd)
         {
-            // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
-            getMembers()->m_queues.push_back(relative_ptr<ChunkQueueData_t>(queueToAdd));
-
-            const auto currChunkHistorySize = getMembers()->m_history.size();
-
-            // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
-            {
-                deliverToQueue(queueToAdd, getMembers()->m_history[i]);
-            }
-
+            // the queue is already in the list
             return cxx::success<void>();
         }
-        else
+        if (queue == nullptr && freeSlot == nullptr)
         {
-            // that's not the fault of the chunk distributor user, we report a moderate error and indicate that adding
-            // the queue was not possible
-            errorHandler(Error::kPOPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, nullptr, ErrorLevel::MODERATE);
-
-            return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+            freeSlot = &slot;
         }
     }
 
+    if (freeSlot == nullptr)
+    {
+        // that's not the fault of the chunk distributor user, we report a moderate error and indicate that adding
+        // the queue was not possible
+        errorHandler(Error::kPOPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER, nullptr, ErrorLevel::MODERATE);
+
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_CONTAINER_OVERFLOW);
+    }
+
+    // the queue must be completely visible for a concurrent lock-free delivery before it is published in the slot
+    std::atomic_thread_fence(std::memory_order_release);
+    *freeSlot = queueToAdd;
+
+    const auto currChunkHistorySize = getMembers()->m_history.size();
+
+    // if the current history is large enough we send the requested number of chunks, else we send the
+    // total history
+    const auto startIndex = (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
+    for (auto i = startIndex; i < currChunkHistorySize; ++i)
+    {
+        deliverToQueue(queueToAdd, getMembers()->m_history[i]);
+    }
+
     return cxx::success<void>();
 }
 
@@ -91,18 +99,18 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    for (auto& slot : getMembers()->m_queues)
     {
-        // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        if (static_cast<ChunkQueueData_t*>(slot) == queueToRemove)
+        {
+            slot = nullptr;
+            waitForOngoingDelivery();
 
-        return cxx::success<void>();
-    }
-    else
-    {
-        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            return cxx::success<void>();
+        }
     }
+
+    return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
 }
 
 template <typename ChunkDistributorDataType>
@@ -110,48 +118,154 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    for (auto& slot : getMembers()->m_queues)
+    {
+        slot = nullptr;
+    }
+    waitForOngoingDelivery();
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    return !getMembers()->m_queues.empty();
+    for (auto& slot : getMembers()->m_queues)
+    {
+        if (static_cast<ChunkQueueData_t*>(slot) != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
-    // send to all the queues
-    for (auto& queue : getMembers()->m_queues)
+    // without a history there is no shared state to modify, this allows to deliver without taking the lock so that
+    // sending never contends with adding and removing queues
+    if (0u == getMembers()->m_historyCapacity)
     {
-        deliverToQueue(queue.get(), chunk);
+        deliverToStoredQueuesLockFree(chunk);
+        return;
     }
 
+    // with a history the lock is needed to guarantee that a newly added queue gets every chunk exactly once and in
+    // order, either from the history or from the delivery
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    deliverToStoredQueuesLockFree(chunk);
+
     // update the history
     addToHistoryWithoutDelivery(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::deliverToStoredQueuesLockFree(const mepoo::SharedChunk& chunk) noexcept
+{
+    // the process does not change during the lifetime of a sender, therefore the pid is queried only once
+    static const pid_t ownPid = getpid();
+    if (getMembers()->m_senderPid.load(std::memory_order_relaxed) != ownPid)
+    {
+        getMembers()->m_senderPid.store(ownPid, std::memory_order_relaxed);
+    }
+
+    // register the delivery in the reader count of the current epoch, if a removal advanced the epoch in the meantime
+    // the registration is repeated in the new epoch since the removal does not wait for the reader count of the new one
+    uint64_t epoch = getMembers()->m_deliveryEpoch.load(std::memory_order_seq_cst);
+    while (true)
+    {
+        getMembers()->m_ongoingDeliveries[epoch % 2u].fetch_add(1u, std::memory_order_seq_cst);
+        const uint64_t currentEpoch = getMembers()->m_deliveryEpoch.load(std::memory_order_seq_cst);
+        if (currentEpoch == epoch)
+        {
+            break;
+        }
+        getMembers()->m_ongoingDeliveries[epoch % 2u].fetch_sub(1u, std::memory_order_release);
+        epoch = currentEpoch;
+    }
+
+    ChunkQueueData_t* queues[MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES];
+    uint64_t numberOfQueues{0u};
+    for (auto& slot : getMembers()->m_queues)
+    {
+        ChunkQueueData_t* const queue = slot;
+        if (queue != nullptr)
+        {
+            queues[numberOfQueues] = queue;
+            ++numberOfQueues;
+        }
+    }
+    // pairs with the release fence in tryAddQueue
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // the references for all queues are acquired with a single increment of the reference counter instead of one
+    // contended increment per queue
+    uint64_t index{0u};
+    chunk.shareWith(numberOfQueues, [&](mepoo::SharedChunk&& owner) {
+        deliverToQueue(queues[index], std::move(owner));
+        ++index;
+    });
+
+    getMembers()->m_ongoingDeliveries[epoch % 2u].fetch_sub(1u, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForOngoingDelivery() noexcept
+{
+    // a delivery which registered in the previous epoch might still use the removed queue, a delivery which confirmed
+    // its registration in the new epoch is guaranteed to see the cleared slot. The removals are serialized by the lock,
+    // therefore the deliveries of older epochs were already waited for by previous removals
+    const uint64_t previousEpoch = getMembers()->m_deliveryEpoch.fetch_add(1u, std::memory_order_seq_cst);
+    auto& ongoingDeliveries = getMembers()->m_ongoingDeliveries[previousEpoch % 2u];
+
+    auto nextLivenessCheck =
+        std::chrono::steady_clock::now()
+        + std::chrono::nanoseconds(CHUNK_DISTRIBUTOR_SENDER_LIVENESS_CHECK_INTERVAL.nanoSeconds<int64_t>());
+    while (ongoingDeliveries.load(std::memory_order_acquire) != 0u)
+    {
+        if (std::chrono::steady_clock::now() > nextLivenessCheck)
+        {
+            if (!isSenderAlive())
+            {
+                // the sender was terminated while delivering, it will not access the queues anymore and also not
+                // unregister its delivery, the reset ensures that later removals do not wait again
+                LogWarn() << "ChunkDistributor: the sender was terminated during an ongoing delivery";
+                ongoingDeliveries.store(0u, std::memory_order_release);
+                return;
+            }
+            nextLivenessCheck =
+                std::chrono::steady_clock::now()
+                + std::chrono::nanoseconds(CHUNK_DISTRIBUTOR_SENDER_LIVENESS_CHECK_INTERVAL.nanoSeconds<int64_t>());
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::isSenderAlive() const noexcept
+{
+    const pid_t senderPid = getMembers()->m_senderPid.load(std::memory_order_relaxed);
+    // the sender might run as a different user, then kill fails with EPERM but the process exists
+    return (senderPid == 0) || (kill(senderPid, 0) == 0) || (errno != ESRCH);
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_null<ChunkQueueData_t* const> queue,
                                                                        mepoo::SharedChunk chunk) noexcept
 {
     // PRQA S 3803 2 # We intentionally do not return anything here as from a ChunkDistributor
     // point of view it doesn't matter if the push succeeds or fails
-    ChunkQueuePusher_t(queue).tryPush(chunk);
+    ChunkQueuePusher_t(queue).tryPush(std::move(chunk));
 }
 
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
     if (0u < getMembers()->m_historyCapacity)
     {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
         {
             // PRQA S 3804 1 # we are not iterating here, so return value can be ignored
@@ -187,6 +301,12 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
 {
+    // without a history the sender never holds the lock while delivering and there is nothing to cleanup
+    if (0u == getMembers()->m_historyCapacity)
+    {
+        return;
+    }
+
     if (getMembers()->tryLock())
     {
         clearHistory();
@@ -195,9 +315,9 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     else
     {
         /// @todo currently we have a deadlock / mutex destroy vulnerability if the ThreadSafePolicy is used
-        /// and a sending application dies when having the lock for sending. If the RouDi daemon wants to
-        /// cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
-        /// As long as we don't have a multi-threaded lock-free ChunkDistributor or another concept we die here
+        /// and a sending application with a history dies when having the lock for sending. If the RouDi daemon wants
+        /// to cleanup or does discovery changes we have a deadlock or an exception when destroying the mutex
+        /// As long as we don't have a lock-free history or another concept we die here
         errorHandler(Error::kPOPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION,
                      nullptr,
                      ErrorLevel::FATAL);
@@ -22,10 +22,12 @@
 #include "iceoryx_utils/cxx/vector.hpp"
 #include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/mutex.hpp"
-#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/atomic_relocatable_ptr.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <sys/types.h>
 
 namespace iox
 {
@@ -44,8 +46,20 @@ struct ChunkDistributorData : public LockingPolicy
 
     const uint64_t m_historyCapacity;
 
-    using QueueContainer_t = cxx::vector<relative_ptr<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    /// @brief Slots for the stored queues, an unused slot contains a nullptr. The slots are only written while
+    /// holding the lock but read lock-free when delivering, therefore atomic pointers are used
+    using QueueSlot_t = atomic_relocatable_ptr<ChunkQueueData_t>;
+    QueueSlot_t m_queues[ChunkDistributorDataProperties_t::MAX_QUEUES];
+
+    /// @brief A lock-free delivery registers itself in the reader count of the current delivery epoch. A removal of
+    /// queues advances the epoch and waits until the reader count of the previous epoch dropped to zero, deliveries
+    /// which start afterwards are registered in the other reader count and cannot delay the removal
+    std::atomic<uint64_t> m_deliveryEpoch{0u};
+    std::atomic<uint64_t> m_ongoingDeliveries[2]{{0u}, {0u}};
+
+    /// @brief The process which delivers lock-free, with it a removal distinguishes a slow sender from a sender which
+    /// was terminated in the middle of a delivery
+    std::atomic<pid_t> m_senderPid{0};
 
     /// @todo using ChunkManagement instead of SharedChunk as in UsedChunkList?
     /// When to store a SharedChunk and when the included ChunkManagement must be used?
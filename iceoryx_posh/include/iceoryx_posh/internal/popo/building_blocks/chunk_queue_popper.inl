@@ -105,13 +105,15 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    // the chunks are handed back to their mempools in batches when the releaser collected enough of them or goes out
+    // of scope
+    mepoo::ChunkReleaser chunkReleaser;
     while (auto maybeChunkTuple = getMembers()->m_queue.pop())
     {
-        // PRQA S 4117 4 # d'tor of SharedChunk will release the memory, so RAII has the side effect here
         auto chunkTupleOut = maybeChunkTuple.value();
         auto chunkManagement =
             iox::relative_ptr<mepoo::ChunkManagement>(chunkTupleOut.m_chunkOffset, chunkTupleOut.m_segmentId);
-        auto chunk = mepoo::SharedChunk(chunkManagement);
+        chunkReleaser.release(mepoo::SharedChunk(chunkManagement));
     }
 }
 
@@ -58,10 +58,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// the user process disappears
     /// @param[in] payloadSize, size of the user paylaod without additional headers
     /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] chunkLayout, the alignment of the payload and the size of the user-header
     /// @return on success pointer to a ChunkHeader which can be used to access the payload and header fields, error if
     /// not
-    cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocate(const uint32_t payloadSize,
-                                                                    const UniquePortId originId) noexcept;
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocate(const uint32_t payloadSize,
+                const UniquePortId originId,
+                const mepoo::ChunkLayout& chunkLayout = mepoo::ChunkLayout()) noexcept;
 
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
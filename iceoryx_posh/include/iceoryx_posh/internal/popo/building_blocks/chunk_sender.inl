@@ -39,19 +39,24 @@ inline typename ChunkSender<ChunkSenderDataType>::MemberType_t* ChunkSender<Chun
 
 template <typename ChunkSenderDataType>
 inline cxx::expected<mepoo::ChunkHeader*, AllocationError>
-ChunkSender<ChunkSenderDataType>::tryAllocate(const uint32_t payloadSize, const UniquePortId originId) noexcept
+ChunkSender<ChunkSenderDataType>::tryAllocate(const uint32_t payloadSize,
+                                              const UniquePortId originId,
+                                              const mepoo::ChunkLayout& chunkLayout) noexcept
 {
-    // use the chunk stored in m_lastChunk if there is one, there is no other owner and the new payload still fits in it
-    const uint32_t neededChunkSize = getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize);
-
+    // use the chunk stored in m_lastChunk if there is one, there is no other owner, it has the same layout and the new
+    // payload still fits in it; the payload offset of the chunk is kept since it depends on the address of the chunk
+    auto lastChunkHeader = getMembers()->m_lastChunk.getChunkHeader();
     if (getMembers()->m_lastChunk && getMembers()->m_lastChunk.hasNoOtherOwners()
-        && (getMembers()->m_lastChunk.getChunkHeader()->m_info.m_totalSizeOfChunk >= neededChunkSize))
+        && lastChunkHeader->m_payloadAlignment == chunkLayout.m_payloadAlignment
+        && lastChunkHeader->m_userHeaderSize == chunkLayout.m_userHeaderSize
+        && static_cast<uint64_t>(lastChunkHeader->m_payloadOffset) + payloadSize
+               <= lastChunkHeader->m_info.m_totalSizeOfChunk)
     {
         if (getMembers()->m_chunksInUse.insert(getMembers()->m_lastChunk))
         {
-            getMembers()->m_lastChunk.getChunkHeader()->m_info.m_payloadSize = payloadSize;
-            getMembers()->m_lastChunk.getChunkHeader()->m_info.m_usedSizeOfChunk = neededChunkSize;
-            return cxx::success<mepoo::ChunkHeader*>(getMembers()->m_lastChunk.getChunkHeader());
+            lastChunkHeader->m_info.m_payloadSize = payloadSize;
+            lastChunkHeader->m_info.m_usedSizeOfChunk = lastChunkHeader->m_payloadOffset + payloadSize;
+            return cxx::success<mepoo::ChunkHeader*>(lastChunkHeader);
         }
         else
         {
@@ -62,7 +67,8 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const uint32_t payloadSize, const
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(payloadSize);
+        mepoo::SharedChunk chunk =
+            getMembers()->m_chunkMagazine.getChunk(getMembers()->m_memoryMgr.get(), payloadSize, chunkLayout);
 
         if (chunk)
         {
@@ -91,8 +97,12 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
-    // PRQA S 4127 1 # d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
-    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    // PRQA S 4127 1 # d'tor of SharedChunk will release the memory if the chunk is not taken back by the magazine
+    if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    {
+        getMembers()->m_chunkMagazine.tryStore(chunk);
+    }
+    else
     {
         errorHandler(Error::kPOPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER, nullptr, ErrorLevel::SEVERE);
     }
@@ -141,6 +151,7 @@ template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
 {
     getMembers()->m_chunksInUse.cleanup();
+    getMembers()->m_chunkMagazine.cleanup();
     this->cleanup();
     getMembers()->m_lastChunk = nullptr;
 }
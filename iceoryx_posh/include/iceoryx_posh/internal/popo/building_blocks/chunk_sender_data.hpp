@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/chunk_magazine.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
@@ -27,7 +28,9 @@ namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
+template <uint32_t MaxChunksAllocatedSimultaneously,
+          typename ChunkDistributorDataType,
+          uint32_t ChunkMagazineCapacity = 0u>
 struct ChunkSenderData : public ChunkDistributorDataType
 {
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
@@ -39,6 +42,7 @@ struct ChunkSenderData : public ChunkDistributorDataType
     const relative_ptr<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
+    ChunkMagazine<ChunkMagazineCapacity> m_chunkMagazine;
     mepoo::SequenceNumberType m_sequenceNumber{0u};
     mepoo::SharedChunk m_lastChunk{nullptr};
 };
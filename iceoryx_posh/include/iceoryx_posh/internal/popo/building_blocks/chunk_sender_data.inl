@@ -18,8 +18,11 @@ namespace iox
 {
 namespace popo
 {
-template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
-inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType>::ChunkSenderData(
+template <uint32_t MaxChunksAllocatedSimultaneously,
+          typename ChunkDistributorDataType,
+          uint32_t ChunkMagazineCapacity>
+inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataType, ChunkMagazineCapacity>::
+    ChunkSenderData(
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const uint64_t historyCapacity,
     const mepoo::MemoryInfo& memoryInfo) noexcept
@@ -40,6 +40,11 @@ struct ConditionVariableData
                                        ErrorLevel::FATAL);
                       })
                       .get_value());
+
+    /// @brief set by a waiter with a WaitStrategy while it polls, the signaler then skips the post of the semaphore
+    std::atomic_bool m_isWaiterPolling{false};
+    /// @brief set by every notification, a polling waiter sees the notification here instead of in the semaphore
+    std::atomic_bool m_wasNotified{false};
 };
 
 } // namespace popo
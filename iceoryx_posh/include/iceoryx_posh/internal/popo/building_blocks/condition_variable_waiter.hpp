@@ -16,6 +16,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_utils/cxx/helplets.hpp"
 
 namespace iox
@@ -41,13 +42,21 @@ class ConditionVariableWaiter
     bool timedWait(const units::Duration timeToWait) noexcept;
     /// @brief Waits until notify is called on the ConditionVariableSignaler
     void wait() noexcept;
+    /// @brief Sets how wait and timedWait wait for a notification, the default blocks right away
+    /// @param[in] waitStrategy, number of spin and yield iterations before the waiter blocks
+    void setWaitStrategy(const WaitStrategy& waitStrategy) noexcept;
 
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
   private:
+    /// @brief Polls for a notification according to the wait strategy
+    /// @return true if a notification arrived, false if the waiter has to block
+    bool pollForNotification() noexcept;
+
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitStrategy m_waitStrategy;
 };
 
 } // namespace popo
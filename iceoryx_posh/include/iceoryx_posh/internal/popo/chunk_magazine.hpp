@@ -0,0 +1,240 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_POPO_CHUNK_MAGAZINE_HPP
+#define IOX_POSH_POPO_CHUNK_MAGAZINE_HPP
+
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_releaser.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A cache of chunks from a single mempool in front of the shared free lists of the mempools. It is refilled
+/// with a batch of chunks when it runs empty and takes back chunks which are released without being delivered, this
+/// keeps the allocations of a port away from the free list shared by all ports. The magazine is not thread-safe and
+/// lives in shared memory, the cached chunks are handed back to the mempools with cleanup, e.g. by RouDi when the
+/// owning process is gone. Cached chunks are accounted as used chunks in the mempool statistics. When the best fitting
+/// mempool is exhausted, the refill follows the spill over policy of the memory manager; such chunks from larger
+/// mempools are handed out but not taken back, they return to their mempool once they are released.
+/// Chunks are handed back to the mempool in batches, half of the magazine when it is full and the complete magazine
+/// when another user of the mempool found it exhausted. Only chunks with the default ChunkLayout are cached, requests
+/// with a custom layout are forwarded to the memory manager.
+/// @tparam Capacity the maximum number of cached chunks, a capacity of 0 disables the magazine
+template <uint32_t Capacity>
+class ChunkMagazine
+{
+  public:
+    ChunkMagazine()
+    {
+        init();
+    }
+
+    // only from runtime context
+    /// @brief takes a chunk for the payload size out of the magazine; an empty magazine is refilled from the best
+    /// fitting mempool, requests for other mempools, with a custom layout or for an exhausted mempool are forwarded to
+    /// the memory manager
+    mepoo::SharedChunk getChunk(mepoo::MemoryManager* const f_memoryManager,
+                                const uint32_t f_payloadSize,
+                                const mepoo::ChunkLayout& f_layout = mepoo::ChunkLayout())
+    {
+        // after a reclaim the request is forwarded, the handed back chunks are left for the other users
+        if (Capacity > 0u && isDefaultLayout(f_layout) && !reclaimIfRequested())
+        {
+            const uint32_t chunkSize = f_memoryManager->getMempoolChunkSizeForPayloadSize(f_payloadSize);
+            if (m_numberOfChunks == 0u && chunkSize != 0u)
+            {
+                refill(f_memoryManager, f_payloadSize, chunkSize);
+            }
+
+            if (m_numberOfChunks > 0u && chunkSize == m_chunkSize)
+            {
+                return pop(f_payloadSize);
+            }
+        }
+
+        return f_memoryManager->getChunk(f_payloadSize, f_layout);
+    }
+
+    // only from runtime context
+    /// @brief takes the chunk back into the magazine if it is the only owner and the chunk fits to the cached ones; a
+    /// full magazine hands back half of its chunks to the mempool in one batch before
+    /// @return true if the chunk was stored, f_chunk is then empty; false if it was not stored, f_chunk is untouched
+    bool tryStore(mepoo::SharedChunk& f_chunk)
+    {
+        if (Capacity > 0u && f_chunk.hasNoOtherOwners()
+            && f_chunk.getChunkHeader()->m_info.m_totalSizeOfChunk == m_chunkSize
+            && isDefaultLayout(*f_chunk.getChunkHeader()))
+        {
+            reclaimIfRequested();
+            if (m_numberOfChunks == Capacity)
+            {
+                flush(Capacity - Capacity / 2u);
+            }
+
+            m_chunks[m_numberOfChunks] = f_chunk.release();
+            ++m_numberOfChunks;
+
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
+        }
+        return false;
+    }
+
+    uint32_t size() const
+    {
+        return m_numberOfChunks;
+    }
+
+    // from RouDi context once the applications walked the plank
+    void cleanup()
+    {
+        m_synchronizer.test_and_set(std::memory_order_acquire);
+
+        // the fill level might be inconsistent if the application died in between, therefore all entries are checked
+        mepoo::ChunkReleaser chunkReleaser;
+        for (auto& chunk : m_chunks)
+        {
+            if (chunk != nullptr)
+            {
+                chunkReleaser.release(mepoo::SharedChunk(chunk));
+            }
+        }
+        chunkReleaser.flush();
+
+        init();
+    }
+
+  private:
+    static bool isDefaultLayout(const mepoo::ChunkLayout& f_layout)
+    {
+        return f_layout.m_payloadAlignment == mepoo::ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT
+               && f_layout.m_userHeaderSize == 0u;
+    }
+
+    static bool isDefaultLayout(const mepoo::ChunkHeader& f_chunkHeader)
+    {
+        return f_chunkHeader.m_payloadOffset == sizeof(mepoo::ChunkHeader);
+    }
+
+    void init()
+    {
+        for (auto& chunk : m_chunks)
+        {
+            chunk = nullptr;
+        }
+        m_numberOfChunks = 0u;
+        m_chunkSize = 0u;
+        m_memPool = nullptr;
+        m_reclaimRequests = 0u;
+
+        m_synchronizer.clear(std::memory_order_release);
+    }
+
+    void refill(mepoo::MemoryManager* const f_memoryManager, const uint32_t f_payloadSize, const uint32_t f_chunkSize)
+    {
+        // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+        std::array<mepoo::SharedChunk, Capacity> chunks;
+        const uint32_t numberOfChunks = f_memoryManager->getChunks(f_payloadSize, chunks.data(), Capacity);
+        for (uint32_t i = 0u; i < numberOfChunks; ++i)
+        {
+            m_chunks[i] = chunks[i].release();
+        }
+        // END of critical section
+        m_numberOfChunks = numberOfChunks;
+        m_chunkSize = f_chunkSize;
+        if (numberOfChunks > 0u)
+        {
+            // the chunks are ordered by their mempools starting with the best fitting one, unless it was exhausted; an
+            // exhaustion caused by this refill is no reason to hand the chunks back immediately
+            m_memPool = m_chunks[0u]->m_mempool;
+            m_reclaimRequests = m_memPool->getReclaimRequests();
+        }
+
+        m_synchronizer.clear(std::memory_order_release);
+    }
+
+    /// @brief hands back all cached chunks in one batch if another user of the mempool found it exhausted since the
+    /// last check
+    /// @return true if chunks were handed back, false otherwise
+    bool reclaimIfRequested()
+    {
+        if (m_numberOfChunks > 0u && m_memPool->getReclaimRequests() != m_reclaimRequests)
+        {
+            m_reclaimRequests = m_memPool->getReclaimRequests();
+            flush(m_numberOfChunks);
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief hands back the f_numberOfChunks most recently stored chunks to their mempools in one batch
+    void flush(const uint32_t f_numberOfChunks)
+    {
+        // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+        mepoo::ChunkReleaser chunkReleaser;
+        for (uint32_t i = 0u; i < f_numberOfChunks; ++i)
+        {
+            --m_numberOfChunks;
+            chunkReleaser.release(mepoo::SharedChunk(m_chunks[m_numberOfChunks]));
+            m_chunks[m_numberOfChunks] = nullptr;
+        }
+        chunkReleaser.flush();
+        // END of critical section
+
+        m_synchronizer.clear(std::memory_order_release);
+    }
+
+    mepoo::SharedChunk pop(const uint32_t f_payloadSize)
+    {
+        --m_numberOfChunks;
+        mepoo::SharedChunk chunk(m_chunks[m_numberOfChunks]);
+        m_chunks[m_numberOfChunks] = nullptr;
+
+        m_synchronizer.clear(std::memory_order_release);
+
+        // a chunk might have been used before it was stored, therefore the chunk header is reset; the chunk size is
+        // kept since a chunk of the refill might come from a larger spill over mempool
+        auto chunkHeader = chunk.getChunkHeader();
+        const uint32_t totalSizeOfChunk = chunkHeader->m_info.m_totalSizeOfChunk;
+        new (chunkHeader) mepoo::ChunkHeader();
+        chunkHeader->m_info.m_payloadSize = f_payloadSize;
+        chunkHeader->m_info.m_usedSizeOfChunk = mepoo::MemoryManager::sizeWithChunkHeaderStruct(f_payloadSize);
+        chunkHeader->m_info.m_totalSizeOfChunk = totalSizeOfChunk;
+
+        return chunk;
+    }
+
+  private:
+    std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
+    uint32_t m_numberOfChunks{0u};
+    uint32_t m_chunkSize{0u};
+    /// the mempool of the cached chunks and its reclaim requests when the magazine looked at them the last time
+    relative_ptr<mepoo::MemPool> m_memPool;
+    uint64_t m_reclaimRequests{0u};
+    std::array<relative_ptr<mepoo::ChunkManagement>, Capacity> m_chunks;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CHUNK_MAGAZINE_HPP
@@ -0,0 +1,63 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_POPO_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/mepoo/chunk_info.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Histogram of the latencies of a tracing point of a port. It lives in the port data in the shared memory, the
+/// application records the latencies and RouDi reads them for the port introspection. The buckets have a logarithmic
+/// scale, see NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS.
+class LatencyHistogram
+{
+  public:
+    LatencyHistogram() noexcept = default;
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram(LatencyHistogram&&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+
+    /// @brief adds the latency between the given timestamp and now
+    void recordSince(const mepoo::TimePointNs start) noexcept;
+
+    /// @brief adds a latency, negative latencies caused by a concurrent update of the timestamp are counted as 0
+    void record(const mepoo::DurationNs latency) noexcept;
+
+    /// @brief returns the index of the bucket which counts the given latency
+    static uint32_t bucketIndex(const uint64_t latencyInNanoseconds) noexcept;
+
+    uint64_t getBucket(const uint32_t index) const noexcept;
+    uint64_t getCount() const noexcept;
+    uint64_t getSumInNanoseconds() const noexcept;
+    uint64_t getMaxInNanoseconds() const noexcept;
+
+  private:
+    std::atomic<uint64_t> m_buckets[NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS]{};
+    std::atomic<uint64_t> m_count{0U};
+    std::atomic<uint64_t> m_sumInNanoseconds{0U};
+    std::atomic<uint64_t> m_maxInNanoseconds{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_LATENCY_HISTOGRAM_HPP
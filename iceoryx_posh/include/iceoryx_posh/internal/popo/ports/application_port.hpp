@@ -43,6 +43,14 @@ class ApplicationPort : public BasePort
     /// @param[in] caProMessage
     void dispatchCaProMessage(const capro::CaproMessage& caProMessage) noexcept;
 
+    /// @brief signals RouDi from the application side that the application is alive, this is done in the shared
+    /// memory without a message to RouDi
+    void sendKeepAlive() noexcept;
+
+    /// @brief get the number of keep alive signals of the application, RouDi checks if it changed
+    /// @return the keep alive counter
+    uint64_t getKeepAliveCounter() const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
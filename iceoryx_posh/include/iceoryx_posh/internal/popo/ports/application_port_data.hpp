@@ -18,6 +18,9 @@
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_utils/internal/concurrent/fifo.hpp"
 
+#include <atomic>
+#include <cstdint>
+
 namespace iox
 {
 namespace popo
@@ -28,6 +31,9 @@ struct ApplicationPortData : public BasePortData
     explicit ApplicationPortData(const ProcessName_t& processName) noexcept;
 
     concurrent::FiFo<capro::CaproMessage, MAX_APPLICATION_CAPRO_FIFO_SIZE> m_caproMessageFiFo;
+
+    /// @brief incremented by the application every PROCESS_KEEP_ALIVE_INTERVAL, RouDi monitors the application with it
+    std::atomic<uint64_t> m_keepAliveCounter{0u};
 };
 
 } // namespace popo
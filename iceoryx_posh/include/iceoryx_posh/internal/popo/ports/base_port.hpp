@@ -78,6 +78,9 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief wakes up the discovery of RouDi, must be called after a CaPro message was made available to RouDi
+    void notifyDiscovery() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
+#include "iceoryx_posh/internal/popo/ports/discovery_trigger.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 #include <atomic>
@@ -55,6 +56,10 @@ struct BasePortData
 
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief set by RouDi when the port is created, the port notifies it when RouDi needs to handle the port
+    relative_ptr<DiscoveryTrigger> m_discoveryTrigger;
+    DiscoveryTrigger::PortKind m_discoveryPortKind{DiscoveryTrigger::PortKind::SENDER};
 };
 
 } // namespace popo
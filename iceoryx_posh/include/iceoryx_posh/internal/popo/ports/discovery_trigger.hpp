@@ -0,0 +1,74 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_POPO_PORTS_DISCOVERY_TRIGGER_HPP
+#define IOX_POSH_POPO_PORTS_DISCOVERY_TRIGGER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_utils/internal/units/duration.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lives in the shared memory of the port pool and wakes up the discovery of RouDi as soon as a port has a
+/// pending CaPro message or shall be destroyed. The kinds of the notifying ports are collected, this allows RouDi to
+/// only look at the ports of these kinds instead of polling all ports cyclically. The notifying port itself is not
+/// recorded, RouDi still scans all ports of a notified kind.
+class DiscoveryTrigger
+{
+  public:
+    enum class PortKind : uint32_t
+    {
+        SENDER = 1u << 0u,
+        RECEIVER = 1u << 1u,
+        APPLICATION = 1u << 2u,
+        INTERFACE = 1u << 3u,
+        RUNNABLE = 1u << 4u,
+    };
+
+    /// @brief bit set of PortKind values
+    using PortKinds_t = uint32_t;
+    static constexpr PortKinds_t ALL_PORT_KINDS{(1u << 5u) - 1u};
+
+    DiscoveryTrigger() noexcept = default;
+    DiscoveryTrigger(const DiscoveryTrigger&) = delete;
+    DiscoveryTrigger(DiscoveryTrigger&&) = delete;
+    DiscoveryTrigger& operator=(const DiscoveryTrigger&) = delete;
+    DiscoveryTrigger& operator=(DiscoveryTrigger&&) = delete;
+
+    /// @brief announces a change of a port of the given kind, only the first notification after RouDi took the
+    /// notified port kinds wakes up RouDi
+    void notify(const PortKind portKind) noexcept;
+
+    /// @brief waits until a port notified a change or the timeout expired
+    /// @return true if there are notified port kinds, false if the timeout expired
+    bool timedWait(const units::Duration timeout) noexcept;
+
+    /// @brief takes the port kinds which notified a change since the last call
+    PortKinds_t takeNotifiedPortKinds() noexcept;
+
+    static bool contains(const PortKinds_t portKinds, const PortKind portKind) noexcept;
+
+  private:
+    std::atomic<PortKinds_t> m_notifiedPortKinds{0u};
+    ConditionVariableData m_conditionVariableData;
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_PORTS_DISCOVERY_TRIGGER_HPP
@@ -48,9 +48,11 @@ class PublisherPortUser : public BasePort
     /// @brief Allocate a chunk, the ownerhip of the SharedChunk remains in the PublisherPortUser for being able to
     /// cleanup if the user process disappears
     /// @param[in] payloadSize, size of the user paylaod without additional headers
+    /// @param[in] chunkLayout, the alignment of the payload and the size of the user-header
     /// @return on success pointer to a ChunkHeader which can be used to access the payload and header fields, error if
     /// not
-    cxx::expected<mepoo::ChunkHeader*, AllocationError> tryAllocateChunk(const uint32_t payloadSize) noexcept;
+    cxx::expected<mepoo::ChunkHeader*, AllocationError>
+    tryAllocateChunk(const uint32_t payloadSize, const mepoo::ChunkLayout& chunkLayout = mepoo::ChunkLayout()) noexcept;
 
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
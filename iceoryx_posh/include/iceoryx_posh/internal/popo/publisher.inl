@@ -64,6 +64,19 @@ inline void* Publisher_t<SenderPortType>::allocateChunk(uint32_t payloadSize, bo
     return chunkHeader->payload();
 }
 
+template <typename SenderPortType>
+inline void* Publisher_t<SenderPortType>::allocateChunk(uint32_t payloadSize,
+                                                       const mepoo::ChunkLayout& chunkLayout,
+                                                       bool useDynamicPayloadSizes) noexcept
+{
+    auto chunkHeader = m_sender.reserveChunk(payloadSize, chunkLayout, useDynamicPayloadSizes);
+    if (chunkHeader == nullptr)
+    {
+        return nullptr;
+    }
+    return chunkHeader->payload();
+}
+
 template <typename SenderPortType>
 inline void Publisher_t<SenderPortType>::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -114,6 +127,18 @@ inline void Publisher_t<SenderPortType>::enableDoDeliverOnSubscription() noexcep
     m_sender.enableDoDeliverOnSubscription();
 }
 
+template <typename SenderPortType>
+inline void Publisher_t<SenderPortType>::enableLatencyTracing() noexcept
+{
+    m_sender.enableLatencyTracing();
+}
+
+template <typename SenderPortType>
+inline void Publisher_t<SenderPortType>::disableLatencyTracing() noexcept
+{
+    m_sender.disableLatencyTracing();
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -84,6 +84,11 @@ class ReceiverPort : public BasePort
     // 'SetReceiveSemaphore(sem_t*)'
     posix::Semaphore* GetShmSemaphore();
 
+    /// @brief While the waiter polls the delivery FiFo, deliver does not post the callback semaphore. After the
+    /// polling ended, the waiter sees all chunks for which the post was skipped.
+    /// @param[in] isPolling true when the polling starts, false when it ends
+    void setWaiterPolling(const bool isPolling) noexcept;
+
     virtual bool deliver(mepoo::SharedChunk f_chunk_p) noexcept;
 
     bool isInternal() const;
@@ -99,6 +104,11 @@ class ReceiverPort : public BasePort
 
     const MemoryInfo& getMemoryInfo() const noexcept;
 
+    /// @brief latencies of the chunks which are traced by the sender, relative to the time the chunk was sent
+    const LatencyHistogram& getSendToDeliverLatency() const noexcept;
+    const LatencyHistogram& getSendToGetLatency() const noexcept;
+    const LatencyHistogram& getSendToReleaseLatency() const noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
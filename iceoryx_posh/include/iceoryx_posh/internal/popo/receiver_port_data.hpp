@@ -16,6 +16,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/internal/popo/delivery_fifo.hpp"
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -53,6 +54,8 @@ struct ReceiverPortData : public BasePortData
     mutable std::atomic_bool m_chunkSendCallbackActive{false};
     mutable mutex_t m_chunkSendCallbackMutex{false};
     iox::relative_ptr<posix::Semaphore> m_chunkSendSemaphore{nullptr};
+    // set by the application while it polls for new chunks instead of waiting on the semaphore
+    std::atomic_bool m_isWaiterPolling{false};
 
     // offer semaphore that is stored in shared memory
     iox_sem_t m_shmSemaphoreHandle;
@@ -61,6 +64,12 @@ struct ReceiverPortData : public BasePortData
     bool m_notifyOverflow{false};
     std::atomic<uint64_t> m_overflowCounter{0u};
 
+    // latencies of the chunks which are traced by the sender, relative to the time the chunk was sent; written by
+    // application, read by RouDi
+    LatencyHistogram m_sendToDeliverLatency;
+    LatencyHistogram m_sendToGetLatency;
+    LatencyHistogram m_sendToReleaseLatency;
+
     MemoryInfo m_memoryInfo;
 };
 
@@ -43,6 +43,9 @@ class SenderPort : public BasePort
 
     void cleanup();
     mepoo::ChunkHeader* reserveChunk(const uint32_t payloadSize, bool useDynamicPayloadSizes = false);
+    mepoo::ChunkHeader* reserveChunk(const uint32_t payloadSize,
+                                     const mepoo::ChunkLayout& chunkLayout,
+                                     bool useDynamicPayloadSizes = false);
     virtual void deliverChunk(mepoo::ChunkHeader* const chunkHeader);
     void freeChunk(mepoo::ChunkHeader* const chunkHeader);
     void activate();
@@ -56,6 +59,13 @@ class SenderPort : public BasePort
     bool isUnique() const;
     uint32_t getMaxDeliveryFiFoCapacity();
 
+    /// @brief the chunks which are reserved after this call record their latencies in the latency histograms of this
+    /// port and of the receiver ports
+    void enableLatencyTracing();
+    void disableLatencyTracing();
+    bool isLatencyTracingEnabled() const;
+    const LatencyHistogram& getAllocateToSendLatency() const;
+
   protected:
     virtual bool connectReceiverPort(ReceiverPortType::MemberType_t* const receiver);
     virtual void deliverChunkToAllReceiver(const mepoo::SharedChunk f_chunk);
@@ -65,6 +75,7 @@ class SenderPort : public BasePort
     void disconnectAllReceiver();
     void setThroughput(const uint32_t payloadSize);
     void setThroughputDeliveryData(mepoo::ChunkInfo& chunk, bool updateTimeInChunk = true);
+    void setLatencyTracing(mepoo::ChunkInfo& chunkInfo);
 
     void disconnectReceiverPort(ReceiverPortType::MemberType_t* const receiver);
 
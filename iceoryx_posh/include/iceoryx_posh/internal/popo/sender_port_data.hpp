@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/receiver_handler.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
@@ -80,6 +81,10 @@ struct SenderPortData : public BasePortData
     mutable concurrent::TACO<Throughput, ThreadContext> m_throughputExchange{
         concurrent::TACOMode::DenyDataFromSameContext};
 
+    // latency tracing related members, written by application, read by RouDi
+    std::atomic_bool m_isLatencyTracingEnabled{false};
+    LatencyHistogram m_allocateToSendLatency;
+
     iox::relative_ptr<mepoo::MemoryManager> m_memoryMgr;
     mepoo::SharedChunk m_lastChunk{nullptr};
 
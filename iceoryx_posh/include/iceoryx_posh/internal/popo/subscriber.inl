@@ -154,12 +154,30 @@ inline bool Subscriber_t<ReceiverPortType>::waitForChunk(const uint32_t timeoutM
     const auto semaphore = m_receiver.GetShmSemaphore();
     assert(semaphore != nullptr && "WaitForChunk: semaphore is not set");
 
+    if (!m_waitStrategy.isBlockingOnly())
+    {
+        m_receiver.setWaiterPolling(true);
+        const bool hasNewChunksWhilePolling = m_waitStrategy.pollUntil([this] { return m_receiver.newData(); });
+        m_receiver.setWaiterPolling(false);
+        // chunks delivered while the flag was still set did not post the semaphore, they are seen here
+        if (hasNewChunksWhilePolling || m_receiver.newData())
+        {
+            return true;
+        }
+    }
+
     struct timespec ts;
     clock_gettime(CLOCK_REALTIME, &ts);
     ts = posix::addTimeMs(ts, timeoutMs);
     return semaphore->timedWait(&ts, true);
 }
 
+template <typename ReceiverPortType>
+inline void Subscriber_t<ReceiverPortType>::setWaitStrategy(const WaitStrategy& waitStrategy) noexcept
+{
+    m_waitStrategy = waitStrategy;
+}
+
 template <typename ReceiverPortType>
 inline bool Subscriber_t<ReceiverPortType>::tryWaitForChunk() noexcept
 {
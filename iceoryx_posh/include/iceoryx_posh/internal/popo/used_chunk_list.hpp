@@ -15,6 +15,7 @@
 #define IOX_POSH_POPO_USED_CHUNK_LIST_HPP
 
 #include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_releaser.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
@@ -114,13 +115,15 @@ class UsedChunkList
     {
         m_synchronizer.test_and_set(std::memory_order_acquire);
 
+        mepoo::ChunkReleaser chunkReleaser;
         for (auto& data : m_data)
         {
             if (data != nullptr)
             {
-                mepoo::SharedChunk{data};
+                chunkReleaser.release(mepoo::SharedChunk(data));
             }
         }
+        chunkReleaser.flush();
 
         init(); // just to save us from the future self
     }
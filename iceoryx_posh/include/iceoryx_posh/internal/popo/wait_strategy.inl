@@ -0,0 +1,49 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_INL
+#define IOX_POSH_POPO_WAIT_STRATEGY_INL
+
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+template <typename Predicate>
+inline bool WaitStrategy::pollUntil(const Predicate& predicate) const noexcept
+{
+    for (uint64_t i = 0U; i < m_spinIterations; ++i)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+    }
+
+    for (uint64_t i = 0U; i < m_yieldIterations; ++i)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+        std::this_thread::yield();
+    }
+
+    return false;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_INL
@@ -183,6 +183,7 @@ void MemPoolIntrospection<MemoryManager, SegmentManager, SenderPort>::copyMemPoo
         dst.m_numChunks = src.m_numChunks;
         dst.m_chunkSize = src.m_chunkSize;
         dst.m_payloadSize = src.m_chunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+        dst.m_spilledChunks = src.m_spilledChunks;
     }
 }
 
@@ -16,6 +16,7 @@
 
 #include "fixed_size_container.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/internal/popo/sender_port_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -253,6 +254,8 @@ class PortIntrospection
         void setNew(bool value);
 
       private:
+        static void copyLatencyHistogram(const popo::LatencyHistogram& histogram, LatencyHistogramData& data);
+
         using SenderContainer = FixedSizeContainer<SenderInfo, MAX_PUBLISHERS>;
         using ConnectionContainer = FixedSizeContainer<ConnectionInfo, MAX_SUBSCRIBERS>;
 
@@ -510,6 +510,7 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(PortThr
             }
             auto sendInterval = introData.currentDeliveryTimestamp - introData.lastDeliveryTimestamp;
             throughputData.m_lastSendIntervalInNanoseconds = sendInterval.count();
+            copyLatencyHistogram(port.getAllocateToSendLatency(), throughputData.m_allocateToSendLatency);
             m_throughputList.emplace_back(throughputData);
             senderInfo.index = index++;
 
@@ -542,6 +543,9 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(
                     receiverData.subscriptionState = port.getSubscribeState();
                     receiverData.sampleSendCallbackActive = port.AreCallbackReferencesSet();
                     receiverData.propagationScope = port.getCaProServiceDescription().getScope();
+                    copyLatencyHistogram(port.getSendToDeliverLatency(), receiverData.sendToDeliverLatency);
+                    copyLatencyHistogram(port.getSendToGetLatency(), receiverData.sendToGetLatency);
+                    copyLatencyHistogram(port.getSendToReleaseLatency(), receiverData.sendToReleaseLatency);
                 }
                 else
                 {
@@ -557,6 +561,19 @@ void PortIntrospection<SenderPort, ReceiverPort>::PortData::prepareTopic(
     }
 }
 
+template <typename SenderPort, typename ReceiverPort>
+void PortIntrospection<SenderPort, ReceiverPort>::PortData::copyLatencyHistogram(
+    const popo::LatencyHistogram& histogram, LatencyHistogramData& data)
+{
+    for (uint32_t i = 0u; i < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS; ++i)
+    {
+        data.m_buckets[i] = histogram.getBucket(i);
+    }
+    data.m_count = histogram.getCount();
+    data.m_sumInNanoseconds = histogram.getSumInNanoseconds();
+    data.m_maxInNanoseconds = histogram.getMaxInNanoseconds();
+}
+
 template <typename SenderPort, typename ReceiverPort>
 bool PortIntrospection<SenderPort, ReceiverPort>::PortData::isNew()
 {
@@ -0,0 +1,76 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_ROUDI_PORT_INDEX_HPP
+#define IOX_POSH_ROUDI_PORT_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief hash over service, instance and event of a service description without wildcards
+struct ServiceDescriptionHash
+{
+    std::size_t operator()(const capro::ServiceDescription& service) const noexcept;
+};
+
+/// @brief Index of the ports of one kind in the port pool, keyed by their service description. It lives in the
+/// process local memory of RouDi and is maintained when the ports are acquired and destroyed. With the index the
+/// lookup of the matching ports in the discovery does not depend on the total number of ports.
+/// Ports with a wildcard in their service description cannot be hashed and are checked for each lookup, a lookup
+/// with a wildcard checks all ports.
+/// @tparam PortDataType the type of the port data, it needs a m_serviceDescription member
+template <typename PortDataType>
+class PortIndex
+{
+  public:
+    /// @brief adds a port to the index
+    /// @param[in] portData the port to add, its service description must not change while it is in the index
+    void add(PortDataType* const portData) noexcept;
+
+    /// @brief removes a port from the index, the order of the remaining ports is preserved
+    /// @param[in] portData the port to remove
+    void remove(PortDataType* const portData) noexcept;
+
+    /// @brief calls the callable with each port whose service description is equal to the provided one
+    /// @param[in] service the service description to look up, wildcards are supported
+    /// @param[in] callable is called with a PortDataType* for each matching port, must not modify the index
+    template <typename Callable>
+    void forEachMatchingPort(const capro::ServiceDescription& service, const Callable& callable) const noexcept;
+
+    /// @brief returns the number of ports in the index
+    uint64_t size() const noexcept;
+
+  private:
+    using PortList_t = std::vector<PortDataType*>;
+
+    static bool hasWildcard(const capro::ServiceDescription& service) noexcept;
+    static bool removeFromList(PortList_t& portList, PortDataType* const portData) noexcept;
+
+    std::unordered_map<capro::ServiceDescription, PortList_t, ServiceDescriptionHash> m_portsByService;
+    PortList_t m_portsWithWildcard;
+    uint64_t m_numberOfPorts{0u};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/port_index.inl"
+
+#endif // IOX_POSH_ROUDI_PORT_INDEX_HPP
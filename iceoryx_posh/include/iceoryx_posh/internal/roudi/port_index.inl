@@ -0,0 +1,129 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_ROUDI_PORT_INDEX_INL
+#define IOX_POSH_ROUDI_PORT_INDEX_INL
+
+#include <algorithm>
+
+namespace iox
+{
+namespace roudi
+{
+template <typename PortDataType>
+inline void PortIndex<PortDataType>::add(PortDataType* const portData) noexcept
+{
+    const auto& service = portData->m_serviceDescription;
+    if (hasWildcard(service))
+    {
+        m_portsWithWildcard.push_back(portData);
+    }
+    else
+    {
+        m_portsByService[service].push_back(portData);
+    }
+    ++m_numberOfPorts;
+}
+
+template <typename PortDataType>
+inline void PortIndex<PortDataType>::remove(PortDataType* const portData) noexcept
+{
+    const auto& service = portData->m_serviceDescription;
+    if (hasWildcard(service))
+    {
+        if (removeFromList(m_portsWithWildcard, portData))
+        {
+            --m_numberOfPorts;
+        }
+        return;
+    }
+
+    auto entry = m_portsByService.find(service);
+    if (entry != m_portsByService.end() && removeFromList(entry->second, portData))
+    {
+        --m_numberOfPorts;
+        if (entry->second.empty())
+        {
+            m_portsByService.erase(entry);
+        }
+    }
+}
+
+template <typename PortDataType>
+template <typename Callable>
+inline void PortIndex<PortDataType>::forEachMatchingPort(const capro::ServiceDescription& service,
+                                                         const Callable& callable) const noexcept
+{
+    if (hasWildcard(service))
+    {
+        for (const auto& entry : m_portsByService)
+        {
+            if (service == entry.first)
+            {
+                for (auto portData : entry.second)
+                {
+                    callable(portData);
+                }
+            }
+        }
+    }
+    else
+    {
+        auto entry = m_portsByService.find(service);
+        if (entry != m_portsByService.end())
+        {
+            for (auto portData : entry->second)
+            {
+                callable(portData);
+            }
+        }
+    }
+
+    for (auto portData : m_portsWithWildcard)
+    {
+        if (service == portData->m_serviceDescription)
+        {
+            callable(portData);
+        }
+    }
+}
+
+template <typename PortDataType>
+inline uint64_t PortIndex<PortDataType>::size() const noexcept
+{
+    return m_numberOfPorts;
+}
+
+template <typename PortDataType>
+inline bool PortIndex<PortDataType>::hasWildcard(const capro::ServiceDescription& service) noexcept
+{
+    return service.getServiceID() == capro::AnyService || service.getInstanceID() == capro::AnyInstance
+           || service.getEventID() == capro::AnyEvent;
+}
+
+template <typename PortDataType>
+inline bool PortIndex<PortDataType>::removeFromList(PortList_t& portList, PortDataType* const portData) noexcept
+{
+    auto position = std::find(portList.begin(), portList.end(), portData);
+    if (position == portList.end())
+    {
+        return false;
+    }
+    portList.erase(position);
+    return true;
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PORT_INDEX_INL
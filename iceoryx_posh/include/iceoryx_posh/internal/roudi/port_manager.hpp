@@ -28,6 +28,7 @@
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
 #include "iceoryx_posh/internal/runtime/runnable_data.hpp"
@@ -60,8 +61,19 @@ class PortManager
     /// @todo Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief handles all ports, independent of whether they notified the discovery trigger
     void doDiscovery() noexcept;
 
+    /// @brief handles only the kind of ports which notified the discovery trigger since the last discovery
+    /// @note the notification does not identify the port, therefore all ports of a notified kind are checked for
+    /// pending CaPro messages, e.g. a single offer leads to a scan of all sender ports
+    void doDiscoveryOfNotifiedPorts() noexcept;
+
+    /// @brief blocks until a port notifies the discovery trigger or the timeout has passed
+    /// @param[in] timeout the maximum time to wait
+    /// @return true if ports notified the trigger, false if the timeout has passed
+    bool waitForDiscoveryTrigger(const units::Duration timeout) noexcept;
+
     /// @deprecated #25
     virtual cxx::expected<SenderPortType::MemberType_t*, PortPoolError>
     acquireSenderPortData(const capro::ServiceDescription& service,
@@ -115,8 +127,17 @@ class PortManager
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
     const std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
+
+    /// @brief the copy of the service registry in the shared memory, which is read by the applications
+    runtime::ServiceRegistryTable* serviceRegistryTable() noexcept;
+
     runtime::MqMessage findService(const capro::ServiceDescription& service) noexcept;
 
+    /// @brief Sends a FIND to all interfaces and looks up the instances of a service in the service registry
+    /// @param[in] service which is searched
+    /// @param[out] instances which were found
+    void findService(const capro::ServiceDescription& service, ServiceRegistry::InstanceSet_t& instances) noexcept;
+
   protected:
     /// @deprecated #25
     void handleSenderPorts();
@@ -151,6 +172,9 @@ class PortManager
     void addEntryToServiceRegistry(const capro::IdString& service, const capro::IdString& instance) noexcept;
     void removeEntryFromServiceRegistry(const capro::IdString& service, const capro::IdString& instance) noexcept;
 
+    /// @brief the applications can only look services up in the service registry table when there are no interfaces
+    void updateLookupInServiceRegistryTable() noexcept;
+
     template <typename T, cxx::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>* = nullptr>
     cxx::optional<ProcessName_t> doesViolateCommunicationPolicy(const capro::ServiceDescription& service) const
         noexcept;
@@ -164,6 +188,13 @@ class PortManager
     PortPool* m_portPool{nullptr};
     ServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
+
+    /// @deprecated #25
+    PortIndex<SenderPortType::MemberType_t> m_senderPortIndex;
+    /// @deprecated #25
+    PortIndex<ReceiverPortType::MemberType_t> m_receiverPortIndex;
+    PortIndex<PublisherPortRouDiType::MemberType_t> m_publisherPortIndex;
+    PortIndex<SubscriberPortType::MemberType_t> m_subscriberPortIndex;
 };
 } // namespace roudi
 } // namespace iox
@@ -23,15 +23,15 @@ inline cxx::optional<ProcessName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) const noexcept
 {
     // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
-        popo::PublisherPortRouDi publisherPort(publisherPortData);
-        if (service == publisherPort.getCaProServiceDescription())
-        {
-            return cxx::make_optional<ProcessName_t>(publisherPortData->m_processName);
-        }
-    }
-    return cxx::nullopt;
+    cxx::optional<ProcessName_t> usedByProcess;
+    m_publisherPortIndex.forEachMatchingPort(
+        service, [&](const PublisherPortRouDiType::MemberType_t* const publisherPortData) {
+            if (!usedByProcess.has_value())
+            {
+                usedByProcess.emplace(publisherPortData->m_processName);
+            }
+        });
+    return usedByProcess;
 }
 
 template <typename T, cxx::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>*>
@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/internal/popo/sender_port.hpp"
 #include "iceoryx_posh/internal/runtime/runnable_data.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_table.hpp"
 #include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 
@@ -68,6 +69,11 @@ struct PortPoolData
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
     std::atomic<uint64_t> m_serviceRegistryChangeCounter{0};
+
+    /// @brief copy of the service registry which is read by the applications without a request to RouDi
+    runtime::ServiceRegistryTable m_serviceRegistryTable;
+
+    popo::DiscoveryTrigger m_discoveryTrigger;
 };
 
 } // namespace roudi
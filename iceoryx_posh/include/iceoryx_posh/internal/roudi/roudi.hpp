@@ -15,7 +15,9 @@
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
 #include <cstdio>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
@@ -57,13 +59,17 @@ class RouDi
           const config::MonitoringMode f_monitoringMode = config::MonitoringMode::ON,
           const bool f_killProcessesInDestructor = true,
           const MQThreadStart mqThreadStart = MQThreadStart::IMMEDIATE,
-          const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH);
+          const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
+          const uint32_t numberOfMqWorkerThreads = ROUDI_MQ_WORKER_THREADS);
 
     virtual ~RouDi();
 
   protected:
-    /// @brief Starts the roudi message queue thread
+    /// @brief Creates the roudi message queue and starts the threads which process the requests
     /// Once this is done, applications can register and Roudi is fully operational.
+    /// @note the requests are handed over to the worker threads by the message queue, every request is received by
+    /// exactly one of them; requests of different applications are therefore processed concurrently and the derived
+    /// classes must be able to handle concurrent calls of processMessage and processBinaryMessage
     void startMQThread();
 
     /// @brief Stops threads and kills all process known to RouDi
@@ -74,6 +80,12 @@ class RouDi
     virtual void processMessage(const runtime::MqMessage& f_data,
                                 const iox::runtime::MqMessageType& f_cmd,
                                 const std::string& f_name);
+
+    /// @brief Handles the requests which are sent with the binary protocol, the response is also sent with the
+    ///        binary protocol. Malformed and unsupported requests are answered with MESSAGE_NOT_SUPPORTED since a
+    ///        binary runtime cannot read a text response.
+    /// @param [in] message the received binary message
+    virtual void processBinaryMessage(runtime::MqBinaryMessage& message);
     virtual void cyclicUpdateHook();
     void mqMessageErrorHandler();
 
@@ -89,16 +101,19 @@ class RouDi
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] protocol which is used for the response
     /// @return Returns if the process could be added successfully.
     bool registerProcess(const std::string& name,
                          int pid,
                          posix::PosixUser user,
                          int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo);
+                         const version::VersionInfo& versionInfo,
+                         const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT);
 
     /// @brief Creates a unique ID which can be used to check outdated mqueue transmissions
     /// @return a unique, monotonic and consecutive increasing number
+    /// @note thread-safe since the worker threads register processes concurrently
     static uint64_t getUniqueSessionIdForProcess();
 
   private:
@@ -111,6 +126,7 @@ class RouDi
     std::atomic_bool m_runThreads;
 
     const units::Duration m_messageQueueTimeout{100_ms};
+    uint32_t m_numberOfMqWorkerThreads{ROUDI_MQ_WORKER_THREADS};
 
   protected:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
@@ -123,7 +139,8 @@ class RouDi
 
   private:
     std::thread m_processManagementThread;
-    std::thread m_processMQThread;
+    std::unique_ptr<runtime::MqInterfaceCreator> m_roudiMqInterface;
+    std::vector<std::thread> m_processMQThreads;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
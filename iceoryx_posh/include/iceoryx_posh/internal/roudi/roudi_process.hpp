@@ -26,10 +26,13 @@
 #include "iceoryx_utils/fixed_string/string100.hpp"
 #include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
 
+#include <chrono>
 #include <csignal>
 #include <cstdint>
 #include <ctime>
 #include <list>
+#include <memory>
+#include <mutex>
 
 namespace iox
 {
@@ -66,6 +69,8 @@ class RouDiProcess
 
     void sendToMQ(const runtime::MqMessage& data) noexcept;
 
+    void sendToMQ(const runtime::MqBinaryMessage& data) noexcept;
+
     /// @brief The session ID which is used to check outdated mqueue transmissions for this process
     /// @return the session ID for this process
     uint64_t getSessionId() noexcept;
@@ -74,19 +79,39 @@ class RouDiProcess
 
     mepoo::TimePointNs getTimestamp() noexcept;
 
+    /// @brief the application port whose keep alive counter is used to monitor the process
+    /// @param [in] applicationPortData the application port of the process
+    void setApplicationPortData(popo::ApplicationPortData* const applicationPortData) noexcept;
+
+    /// @brief sets the timestamp to the provided one if the process signaled keep alive in its application port since
+    /// the last call
+    /// @note the application port is dropped once it is destroyed or belongs to another process, from then on only
+    /// KEEPALIVE messages refresh the timestamp; the runtime sends them when its application port is destroyed
+    /// @param [in] timestamp the current time
+    void updateTimestampFromKeepAliveCounter(const mepoo::TimePointNs timestamp) noexcept;
+
     mepoo::MemoryManager* getPayloadMemoryManager() const noexcept;
     uint64_t getPayloadSegmentId() const noexcept;
 
     bool isMonitored() const noexcept;
 
+    /// @brief marks the process as removed from the ProcessManager, port requests of the process which are processed
+    /// concurrently to the removal must not acquire ports anymore since they would not be cleaned up
+    void markAsRemoved() noexcept;
+
+    bool isRemoved() const noexcept;
+
   private:
     int m_pid;
     runtime::MqInterfaceUser m_mq;
     mepoo::TimePointNs m_timestamp;
+    popo::ApplicationPortData* m_applicationPortData{nullptr};
+    uint64_t m_lastKeepAliveCounter{0u};
     mepoo::MemoryManager* m_payloadMemoryManager{nullptr};
     bool m_isMonitored{true};
     uint64_t m_payloadSegmentId;
     std::atomic<uint64_t> m_sessionId;
+    std::atomic_bool m_isRemoved{false};
 };
 
 class ProcessManagerInterface
@@ -103,7 +128,9 @@ class ProcessManager : public ProcessManagerInterface
   public:
     /// @todo use a fixed, stack based list once available
     // using ProcessList_t = cxx::list<RouDiProcess, MAX_PROCESS_NUMBER>;
-    using ProcessList_t = std::list<RouDiProcess>;
+    /// @note the processes are shared with the requests which are processed concurrently, this way a request can
+    /// still answer a process which is removed in the meantime
+    using ProcessList_t = std::list<std::shared_ptr<RouDiProcess>>;
     using PortConfigInfo = iox::runtime::PortConfigInfo;
 
     ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
@@ -122,6 +149,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] protocol which is used for the REG_ACK
     /// @return Returns if the process could be added successfully.
     bool registerProcess(const ProcessName_t& name,
                          int32_t pid,
@@ -129,13 +157,16 @@ class ProcessManager : public ProcessManagerInterface
                          bool isMonitored,
                          int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void killAllProcesses() noexcept;
 
     void updateLivelinessOfProcess(const ProcessName_t& name) noexcept;
 
-    void findServiceForProcess(const ProcessName_t& name, const capro::ServiceDescription& service) noexcept;
+    void findServiceForProcess(const ProcessName_t& name,
+                               const capro::ServiceDescription& service,
+                               const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void addInterfaceForProcess(const ProcessName_t& name,
                                 capro::Interfaces interface,
@@ -149,25 +180,29 @@ class ProcessManager : public ProcessManagerInterface
     void addReceiverForProcess(const ProcessName_t& name,
                                const capro::ServiceDescription& service,
                                const RunnableName_t& runnable,
-                               const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+                               const PortConfigInfo& portConfigInfo = PortConfigInfo(),
+                               const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     /// @deprecated #25
     void addSenderForProcess(const ProcessName_t& name,
                              const capro::ServiceDescription& service,
                              const RunnableName_t& runnable,
-                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+                             const PortConfigInfo& portConfigInfo = PortConfigInfo(),
+                             const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void addSubscriberForProcess(const ProcessName_t& name,
                                  const capro::ServiceDescription& service,
                                  const uint64_t& historyRequest,
                                  const RunnableName_t& runnable,
-                                 const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+                                 const PortConfigInfo& portConfigInfo = PortConfigInfo(),
+                                 const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void addPublisherForProcess(const ProcessName_t& name,
                                 const capro::ServiceDescription& service,
                                 const uint64_t& historyCapacity,
                                 const RunnableName_t& runnable,
-                                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+                                const PortConfigInfo& portConfigInfo = PortConfigInfo(),
+                                const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void addConditionVariableForProcess(const ProcessName_t& processName) noexcept;
 
@@ -179,14 +214,23 @@ class ProcessManager : public ProcessManagerInterface
                                               const ProcessName_t& process_name) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
-    void sendMessageNotSupportedToRuntime(const ProcessName_t& name) noexcept;
+    void sendMessageNotSupportedToRuntime(const ProcessName_t& name,
+                                          const runtime::MqProtocol protocol = runtime::MqProtocol::TEXT) noexcept;
 
     void sendServiceRegistryChangeCounterToProcess(const ProcessName_t& process_name) noexcept override;
 
+    /// @brief sends the relative pointer to the service registry table in which the application looks services up
+    void sendServiceRegistryTableToProcess(const ProcessName_t& processName) noexcept;
+
   private:
-    RouDiProcess* getProcessFromList(const ProcessName_t& name) noexcept;
+    /// @note m_mutex must be locked by the caller
+    std::shared_ptr<RouDiProcess> getProcessFromList(const ProcessName_t& name) noexcept;
+
+    /// @brief looks the process up while m_mutex is locked
+    std::shared_ptr<RouDiProcess> findProcess(const ProcessName_t& name) noexcept;
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
+    void notifiedDiscoveryUpdate() noexcept;
 
     /// @param [in] name of the process; this is equal to the mqueue name, which is used for communication
     /// @param [in] pid is the host system process id
@@ -196,6 +240,7 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] payloadSegmentId is an identifier for the shm payload segment
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated mqueue transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] protocol which is used for the REG_ACK
     /// @return Returns if the process could be added successfully.
     bool addProcess(const ProcessName_t& name,
                     int32_t pid,
@@ -204,20 +249,45 @@ class ProcessManager : public ProcessManagerInterface
                     int64_t transmissionTimestamp,
                     const uint64_t payloadSegmentId,
                     const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+                    const version::VersionInfo& versionInfo,
+                    const runtime::MqProtocol protocol) noexcept;
+
+    /// @brief sends the ACK of a port request with the relative pointer of the port in the requested protocol
+    void sendPortAckToProcess(RouDiProcess& process,
+                              const runtime::MqProtocol protocol,
+                              const runtime::MqMessageType ackType,
+                              const RelativePointer::offset_t offset) noexcept;
+
+    /// @brief sends an ERROR response in the requested protocol
+    void sendErrorToProcess(RouDiProcess& process,
+                            const runtime::MqProtocol protocol,
+                            const runtime::MqMessageErrorType error) noexcept;
 
     bool removeProcess(const ProcessName_t& name) noexcept;
+
+    /// @brief deletes the ports of the process and removes it from the list
+    /// @note m_mutex must be locked by the caller
+    /// @return the iterator to the process after the removed one
+    ProcessList_t::iterator eraseProcess(ProcessList_t::iterator processIterator) noexcept;
+
     RouDiMemoryInterface& m_roudiMemoryInterface;
     PortManager& m_portManager;
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     RelativePointer::id_t m_mgmtSegmentId{RelativePointer::NULL_POINTER_ID};
+    /// @brief protects the process list and the processes in it; the requests of different processes are processed
+    /// concurrently and only need it for the look up of the process
     mutable std::mutex m_mutex;
+    /// @brief protects the PortManager, which is used by the requests and the discovery; if both mutexes are needed,
+    /// m_mutex must be locked first
+    mutable std::mutex m_portManagerMutex;
 
     ProcessList_t m_processList;
 
     ProcessIntrospectionType* m_processIntrospection{nullptr};
 
+    std::chrono::steady_clock::time_point m_nextFullDiscovery{std::chrono::steady_clock::now()};
+
     // this is currently used for the internal sender/receiver ports
     mepoo::MemoryManager* m_memoryManagerOfCurrentProcess{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
@@ -36,7 +36,8 @@ class RouDiEnvironment
   public:
     RouDiEnvironment(const RouDiConfig_t& roudiConfig = RouDiConfig_t().setDefaults(),
                      config::MonitoringMode monitoringMode = config::MonitoringMode::OFF,
-                     const uint16_t uniqueRouDiId = 0u);
+                     const uint16_t uniqueRouDiId = 0u,
+                     const uint32_t numberOfMqWorkerThreads = ROUDI_MQ_WORKER_THREADS);
     virtual ~RouDiEnvironment();
 
     RouDiEnvironment(RouDiEnvironment&& rhs) = default;
@@ -0,0 +1,192 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_HPP
+#define IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_utils/cxx/string.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief The protocol which is used for the messages between a runtime and RouDi
+enum class MqProtocol : uint8_t
+{
+    /// @brief separator separated strings, see MqMessage
+    TEXT,
+    /// @brief fixed-layout typed fields, see MqBinaryMessage
+    BINARY
+};
+
+/// @brief The protocol which is used by the runtime. The default is the text protocol since it is understood by every
+///        RouDi, the binary protocol can be activated with the BINARY_MQ_PROTOCOL build option. RouDi accepts both
+///        protocols and always answers in the protocol of the request.
+constexpr MqProtocol DEFAULT_MQ_PROTOCOL{build::IOX_BINARY_MQ_PROTOCOL ? MqProtocol::BINARY : MqProtocol::TEXT};
+
+/// @details
+///    A binary message is serialized into a fixed-size buffer which is part of the object, therefore no heap memory
+///    is needed to build, send, receive or parse it.
+///
+///    The layout uses the native byte order since both communication partners run on the same host.
+///      header: | magic (1 byte) | version (1 byte) | number of fields (2 bytes) | payload size (4 bytes) |
+///      field:  | field type (1 byte) | value |
+///    with the values
+///      UNSIGNED: 8 byte unsigned integer
+///      SIGNED:   8 byte signed integer
+///      STRING:   2 byte length followed by the characters without null termination
+///
+///    The magic byte is not a printable character, therefore a binary message can be told apart from a text message
+///    (see MqMessage) by its first byte.
+///
+///    A message becomes invalid if a field does not fit into the buffer. Fields are read sequentially in the order
+///    they were added. Reading a field with another type or beyond the last field fails and does not change the
+///    read position.
+class MqBinaryMessage
+{
+  public:
+    static constexpr uint8_t MAGIC{0xA5u};
+    static constexpr uint8_t VERSION{1u};
+    static constexpr uint32_t CAPACITY{APP_MESSAGE_SIZE > ROUDI_MESSAGE_SIZE ? APP_MESSAGE_SIZE : ROUDI_MESSAGE_SIZE};
+
+    enum class FieldType : uint8_t
+    {
+        UNSIGNED = 1,
+        SIGNED,
+        STRING
+    };
+
+    /// @brief Creates an empty and valid binary message
+    MqBinaryMessage() noexcept;
+
+    MqBinaryMessage(const MqBinaryMessage&) = default;
+    MqBinaryMessage(MqBinaryMessage&&) = default;
+    MqBinaryMessage& operator=(const MqBinaryMessage&) = default;
+    MqBinaryMessage& operator=(MqBinaryMessage&&) = default;
+    ~MqBinaryMessage() = default;
+
+    /// @brief Appends an UNSIGNED field
+    MqBinaryMessage& addUnsigned(const uint64_t value) noexcept;
+
+    /// @brief Appends a SIGNED field
+    MqBinaryMessage& addSigned(const int64_t value) noexcept;
+
+    /// @brief Appends a STRING field
+    /// @param[in] value pointer to the characters, a null termination is not required
+    /// @param[in] length number of characters
+    MqBinaryMessage& addString(const char* const value, const uint64_t length) noexcept;
+
+    /// @brief Appends a STRING field with the content of a fixed string
+    template <uint64_t Capacity>
+    MqBinaryMessage& addString(const cxx::string<Capacity>& value) noexcept;
+
+    /// @brief Appends the strings, the class hash, the source interface and the scope of a service description
+    MqBinaryMessage& addServiceDescription(const capro::ServiceDescription& service) noexcept;
+
+    /// @brief Appends the port type, the device id and the memory type of a port config info
+    MqBinaryMessage& addPortConfigInfo(const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief Reads the next field if it is an UNSIGNED field
+    /// @return true if the field could be read, otherwise false
+    bool readUnsigned(uint64_t& value) noexcept;
+
+    /// @brief Reads the next field if it is a SIGNED field
+    /// @return true if the field could be read, otherwise false
+    bool readSigned(int64_t& value) noexcept;
+
+    /// @brief Reads the next field if it is a STRING field which fits into the fixed string
+    /// @return true if the field could be read, otherwise false
+    template <uint64_t Capacity>
+    bool readString(cxx::string<Capacity>& value) noexcept;
+
+    /// @brief Reads a service description which was added with addServiceDescription
+    /// @return true if the service description could be read, otherwise false
+    bool readServiceDescription(capro::ServiceDescription& service) noexcept;
+
+    /// @brief Reads a port config info which was added with addPortConfigInfo
+    /// @return true if the port config info could be read, otherwise false
+    bool readPortConfigInfo(PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief Checks if a STRING field with the given number of characters still fits into the message
+    bool hasSpaceForString(const uint64_t length) const noexcept;
+
+    /// @brief Restarts reading with the first field
+    void resetReadPosition() noexcept;
+
+    /// @brief Returns the number of fields stored in the message
+    uint32_t getNumberOfFields() const noexcept;
+
+    /// @brief check if the message is valid
+    /// @return false if a field did not fit into the message or a received message has an invalid header,
+    ///         otherwise true
+    bool isValid() const noexcept;
+
+    /// @brief Clears the message. After a call to clearMessage() the message becomes valid again.
+    void clearMessage() noexcept;
+
+    /// @brief Returns the serialized message which can be handed over to the message queue
+    const void* getData() const noexcept;
+
+    /// @brief Returns the size of the serialized message in bytes
+    uint32_t getSize() const noexcept;
+
+    /// @brief Returns the buffer in which a message can be received, it has the size CAPACITY
+    void* getReceiveBuffer() noexcept;
+
+    /// @brief Interprets the first receivedSize bytes of the receive buffer as message. The message becomes invalid
+    ///        if it is not a binary message, has an unsupported version or the header does not match the size.
+    /// @param[in] receivedSize number of bytes which were written to the receive buffer
+    /// @return isValid()
+    bool setReceivedSize(const uint64_t receivedSize) noexcept;
+
+    /// @brief Checks if a raw message starts with the binary message magic byte
+    /// @param[in] data pointer to the raw message
+    /// @param[in] size of the raw message in bytes
+    static bool isBinaryMessage(const void* const data, const uint64_t size) noexcept;
+
+  private:
+    struct Header
+    {
+        uint8_t magic;
+        uint8_t version;
+        uint16_t numberOfFields;
+        uint32_t payloadSize;
+    };
+
+    static constexpr uint32_t HEADER_SIZE{sizeof(Header)};
+    static constexpr uint32_t FIELD_TYPE_SIZE{sizeof(FieldType)};
+
+    bool appendField(const FieldType type, const void* const value, const uint32_t valueSize) noexcept;
+    bool readFieldType(const FieldType expectedType, uint32_t& position) const noexcept;
+    bool readStringView(const char*& value, uint16_t& length) noexcept;
+    Header readHeader() const noexcept;
+    void writeHeader(const Header& header) noexcept;
+
+  private:
+    alignas(8) uint8_t m_buffer[CAPACITY];
+    uint32_t m_size{HEADER_SIZE};
+    uint32_t m_readPosition{HEADER_SIZE};
+    bool m_isValid{true};
+};
+
+} // namespace runtime
+} // namespace iox
+
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.inl"
+
+#endif // IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_HPP
@@ -0,0 +1,53 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_INL
+#define IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_INL
+
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+template <uint64_t Capacity>
+inline MqBinaryMessage& MqBinaryMessage::addString(const cxx::string<Capacity>& value) noexcept
+{
+    return addString(value.c_str(), value.size());
+}
+
+template <uint64_t Capacity>
+inline bool MqBinaryMessage::readString(cxx::string<Capacity>& value) noexcept
+{
+    const auto readPosition = m_readPosition;
+    const char* str{nullptr};
+    uint16_t length{0u};
+    if (!readStringView(str, length))
+    {
+        return false;
+    }
+
+    if (length > Capacity)
+    {
+        m_readPosition = readPosition;
+        return false;
+    }
+
+    value = cxx::string<Capacity>(cxx::TruncateToCapacity, str, length);
+    return true;
+}
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_MESSAGE_QUEUE_BINARY_MESSAGE_INL
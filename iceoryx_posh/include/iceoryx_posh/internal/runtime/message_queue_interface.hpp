@@ -15,7 +15,9 @@
 #define IOX_POSH_RUNTIME_MESSAGE_QUEUE_INTERFACE_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/message_queue.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/unix_domain_socket.hpp"
 #include "iceoryx_utils/internal/units/duration.hpp"
@@ -71,6 +73,8 @@ enum class MqMessageType : int32_t
     REPLAY,
     SERVICE_REGISTRY_CHANGE_COUNTER,
     MESSAGE_NOT_SUPPORTED,
+    SERVICE_REGISTRY_TABLE,
+    SERVICE_REGISTRY_TABLE_ACK,
     // etc..
     END,
 };
@@ -156,6 +160,38 @@ class MqBase
     ///             an error, it will return false.
     bool timedSend(const MqMessage& msg, const units::Duration timeout) const noexcept;
 
+    /// @brief Receives a binary message from the message queue without any heap allocation
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return false if the call to mq_receive failed or no valid binary message was received, otherwise true
+    bool receive(MqBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a binary message from the message queue within a specified timeout
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] answer If a message is received it is stored there.
+    /// @return true if a valid binary message was received before the timeout occured, otherwise false
+    bool timedReceive(const units::Duration timeout, MqBinaryMessage& answer) const noexcept;
+
+    /// @brief Tries to receive a message of either protocol within a specified timeout. A text message is stored
+    ///        in textAnswer, a binary message in binaryAnswer.
+    /// @param[in] timeout for receiving a message.
+    /// @param[out] textAnswer stores a received text message
+    /// @param[out] binaryAnswer stores a received binary message
+    /// @return the protocol of the received message if a valid message was received, otherwise nullopt
+    cxx::optional<MqProtocol> timedReceiveAnyProtocol(const units::Duration timeout,
+                                                      MqMessage& textAnswer,
+                                                      MqBinaryMessage& binaryAnswer) const noexcept;
+
+    /// @brief Tries to send a binary message.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @return true if the message was sent, otherwise false
+    bool send(const MqBinaryMessage& msg) const noexcept;
+
+    /// @brief Tries to send a binary message within a specified timeout.
+    /// @param[in] msg Must be a valid message, if its an invalid message send will return false
+    /// @param[in] timeout specifies the duration to wait for sending.
+    /// @return true if the message was sent, otherwise false
+    bool timedSend(const MqBinaryMessage& msg, const units::Duration timeout) const noexcept;
+
     /// @brief Returns the interface name, the unique char string which
     ///         explicitly identifies the message queue.
     /// @return name of the message queue
@@ -310,9 +346,11 @@ class MqRuntimeInterface
     /// @param[in] roudiName name of the RouDi message queue
     /// @param[in] appName name of the appplication and its message queue
     /// @param[in] roudiWaitingTimeout timeout for searching the RouDi message queue
+    /// @param[in] protocol which is used for the registration and the requests which support the binary protocol
     MqRuntimeInterface(const std::string& roudiName,
                        const std::string& appName,
-                       const units::Duration roudiWaitingTimeout) noexcept;
+                       const units::Duration roudiWaitingTimeout,
+                       const MqProtocol protocol = DEFAULT_MQ_PROTOCOL) noexcept;
     ~MqRuntimeInterface() = default;
 
     /// @brief Not needed therefore deleted
@@ -331,6 +369,16 @@ class MqRuntimeInterface
     /// @return true if communication was successful, false if not
     bool sendRequestToRouDi(const MqMessage& msg, MqMessage& answer) noexcept;
 
+    /// @brief send a binary request to the RouDi daemon
+    /// @param[in] msg request to RouDi
+    /// @param[out] answer binary response from RouDi
+    /// @return true if communication was successful, false if not
+    bool sendRequestToRouDi(const MqBinaryMessage& msg, MqBinaryMessage& answer) noexcept;
+
+    /// @brief get the protocol which was selected for this runtime interface
+    /// @return the protocol
+    MqProtocol getProtocol() const noexcept;
+
     /// @brief send a message to the RouDi daemon
     /// @param[in] msg message which will be send to RouDi
     /// @return true if communication was successful, otherwise false
@@ -363,6 +411,18 @@ class MqRuntimeInterface
     /// @return
     RegAckResult waitForRegAck(int64_t transmissionTimestamp) noexcept;
 
+    /// @brief sends the REG message with the selected protocol
+    /// @return true if the message was sent, otherwise false
+    bool sendRegisterRequest(const int64_t transmissionTimestamp) noexcept;
+
+    /// @brief waits for a text REG_ACK and stores its content
+    /// @return true if a REG_ACK was received, otherwise false
+    bool receiveTextRegAck(int64_t& receivedTimestamp) noexcept;
+
+    /// @brief waits for a binary REG_ACK and stores its content
+    /// @return true if a REG_ACK was received, otherwise false
+    bool receiveBinaryRegAck(int64_t& receivedTimestamp) noexcept;
+
   private:
     std::string m_appName;
     std::string m_segmentManager;
@@ -370,6 +430,7 @@ class MqRuntimeInterface
     MqInterfaceUser m_RoudiMqInterface;
     size_t m_shmTopicSize{0u};
     uint64_t m_segmentId{0u};
+    MqProtocol m_protocol{DEFAULT_MQ_PROTOCOL};
 };
 } // namespace runtime
 } // namespace iox
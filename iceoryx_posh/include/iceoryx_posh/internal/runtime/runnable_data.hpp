@@ -14,7 +14,9 @@
 #ifndef IOX_POSH_RUNTIME_RUNNABLE_DATA_HPP
 #define IOX_POSH_RUNTIME_RUNNABLE_DATA_HPP
 
+#include "iceoryx_posh/internal/popo/ports/discovery_trigger.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
 
 #include <atomic>
 
@@ -43,6 +45,8 @@ class RunnableData
     iox::cxx::CString100 m_runnable;
     uint64_t m_runnableDeviceIdentifier;
     std::atomic_bool m_toBeDestroyed{false};
+    /// @brief set by RouDi when the runnable is created, notified when the runnable shall be destroyed
+    relative_ptr<popo::DiscoveryTrigger> m_discoveryTrigger;
 };
 } // namespace runtime
 } // namespace iox
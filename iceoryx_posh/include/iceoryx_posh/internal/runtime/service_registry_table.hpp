@@ -0,0 +1,84 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_RUNTIME_SERVICE_REGISTRY_TABLE_HPP
+#define IOX_POSH_RUNTIME_SERVICE_REGISTRY_TABLE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Lives in the shared memory of the port pool and contains the same service and instance pairs as the service
+/// registry of RouDi. RouDi is the only writer, the applications look services up without a request to RouDi. The
+/// table is protected by a seqlock, a reader retries when RouDi changed the table while it was read.
+class ServiceRegistryTable
+{
+  public:
+    /// @brief every offered service is offered by at least one sender or publisher port
+    static constexpr uint32_t CAPACITY{2U * MAX_PUBLISHERS};
+    /// @brief a reader gives up after this number of concurrent changes, e.g. when RouDi died while writing
+    static constexpr uint32_t MAX_READ_ATTEMPTS{100U};
+
+    ServiceRegistryTable() noexcept = default;
+    ServiceRegistryTable(const ServiceRegistryTable&) = delete;
+    ServiceRegistryTable(ServiceRegistryTable&&) = delete;
+    ServiceRegistryTable& operator=(const ServiceRegistryTable&) = delete;
+    ServiceRegistryTable& operator=(ServiceRegistryTable&&) = delete;
+
+    /// @brief adds the pair if it is not yet contained, must only be called by RouDi
+    /// @return false if the table is full, then it is marked as incomplete and cannot be used for look ups anymore
+    bool add(const capro::IdString& service, const capro::IdString& instance) noexcept;
+
+    /// @brief removes the pair if it is contained, must only be called by RouDi
+    void remove(const capro::IdString& service, const capro::IdString& instance) noexcept;
+
+    /// @brief RouDi forwards a FIND to the interface ports, as long as there are some the look up must be done by
+    /// RouDi; must only be called by RouDi
+    void setLookupByRouDiRequired(const bool required) noexcept;
+
+    /// @brief looks up the instances of the service, the wildcard capro::AnyInstanceString finds all instances
+    /// @param[out] instances the found instances, only the ones which fit into the container are stored
+    /// @param[out] numberOfFoundInstances the number of found instances, it can exceed the capacity of instances
+    /// @return false if the table cannot be used for the look up and RouDi must be asked
+    bool find(const capro::IdString& service,
+              const capro::IdString& instance,
+              InstanceContainer& instances,
+              uint64_t& numberOfFoundInstances) const noexcept;
+
+  private:
+    struct Entry
+    {
+        capro::IdString m_service;
+        capro::IdString m_instance;
+    };
+
+    void beginWrite() noexcept;
+    void endWrite() noexcept;
+
+    /// @brief odd while RouDi writes
+    std::atomic<uint64_t> m_sequence{0U};
+    uint32_t m_size{0U};
+    bool m_isIncomplete{false};
+    std::atomic_bool m_isLookupByRouDiRequired{false};
+    Entry m_entries[CAPACITY];
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_SERVICE_REGISTRY_TABLE_HPP
@@ -26,25 +26,81 @@ namespace iox
 {
 namespace mepoo
 {
+/// @brief describes where the payload is placed in a chunk
+struct ChunkLayout
+{
+    /// @brief the payload alignment which needs no padding between the ChunkHeader and the payload
+    static constexpr uint32_t DEFAULT_PAYLOAD_ALIGNMENT{32u};
+
+    ChunkLayout() noexcept = default;
+
+    /// @brief set the alignment of the payload and the size of the user-header
+    ChunkLayout(const uint32_t f_payloadAlignment, const uint32_t f_userHeaderSize) noexcept
+        : m_payloadAlignment(f_payloadAlignment)
+        , m_userHeaderSize(f_userHeaderSize)
+    {
+    }
+
+    /// @brief alignment of the payload, must be a power of two; an alignment larger than the one of the ChunkHeader
+    /// requires a larger chunk
+    uint32_t m_payloadAlignment{DEFAULT_PAYLOAD_ALIGNMENT};
+
+    /// @brief size of the user-header which is placed right behind the ChunkHeader, 0 if there is no user-header
+    uint32_t m_userHeaderSize{0u};
+};
+
 /// @brief IMPORTANT the alignment MUST be 32 or less since all mempools are
 ///         32 byte aligned otherwise we get alignment problems!
+/// @note the payload is located m_payloadOffset bytes behind the ChunkHeader, the offset is also stored in the
+///       4 bytes right in front of the payload to find the ChunkHeader from the payload; with the default layout these
+///       are the bytes of m_payloadOffset itself
 struct alignas(32) ChunkHeader
 {
+    using PayloadOffset_t = uint32_t;
+
     /// @brief ALlocates memory to store the information about the chunks.
     ChunkHeader() noexcept;
 
+    /// @brief creates a ChunkHeader for a chunk with the given layout, the chunk must provide at least
+    /// requiredChunkSize bytes starting at the address of the ChunkHeader
+    /// @param[in] layout the alignment of the payload and the size of the user-header
+    explicit ChunkHeader(const ChunkLayout& layout) noexcept;
+
     UniquePortId m_originId{popo::CreateInvalidId};
     ChunkInfo m_info;
 
+    /// @brief size of the user-header, 0 if there is none
+    uint32_t m_userHeaderSize{0u};
+
+    /// @brief alignment of the payload
+    uint32_t m_payloadAlignment{ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT};
+
+    /// @brief reserved for future use, keeps m_payloadOffset at the end of the ChunkHeader
+    uint32_t m_reserved[3]{0u, 0u, 0u};
+
+    /// @brief offset of the payload relative to the ChunkHeader, this MUST be the last member
+    PayloadOffset_t m_payloadOffset{sizeof(ChunkHeader)};
+
     void* payload() const
     {
-        // payload is always located relative to "this" in this way
+        return reinterpret_cast<void*>(reinterpret_cast<uint64_t>(this) + m_payloadOffset);
+    }
+
+    /// @brief returns the user-header which is located right behind the ChunkHeader or nullptr if there is none
+    void* userHeader() const
+    {
+        if (m_userHeaderSize == 0u)
+        {
+            return nullptr;
+        }
         return reinterpret_cast<void*>(reinterpret_cast<uint64_t>(this) + sizeof(ChunkHeader));
     }
 
-    /// @todo this is a temporary dummy variable to keep the size of the ChunkHeader at 64 byte for compatibility
-    /// reasons
-    void* m_payloadDummy{nullptr};
+    /// @brief calculates the chunk size which is needed for the payload with the given layout; payload alignments
+    /// larger than the alignment of the ChunkHeader are taken into account with the worst case padding since the
+    /// offset of the payload depends on the address of the chunk
+    /// @return the required chunk size, might exceed the range of uint32_t for huge payloads or alignments
+    static uint64_t requiredChunkSize(const uint32_t payloadSize, const ChunkLayout& layout) noexcept;
 };
 
 ChunkHeader* convertPayloadPointerToChunkHeader(const void* const payload) noexcept;
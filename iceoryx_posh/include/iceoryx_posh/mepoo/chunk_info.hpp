@@ -35,6 +35,11 @@ using TimePointNs = std::chrono::time_point<BaseClock, DurationNs>;
 struct ChunkInfo
 {
     bool m_externalSequenceNumber_bl{false};
+
+    /// @brief the latencies of this chunk are recorded in the latency histograms of the ports; until the chunk is sent
+    /// m_txTimestamp contains the time of the allocation
+    bool m_isLatencyTraced{false};
+
     SequenceNumberType m_sequenceNumber{0};
 
     /// @brief size of the user data object
@@ -45,6 +45,10 @@ struct MePooConfig
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
 
+    /// @brief number of larger memory pools which are tried when the best fitting memory pool has no free chunks
+    /// left, 0 disables the spill over to larger memory pools
+    uint32_t m_spillOverMemPools{0u};
+
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() = default;
 
@@ -56,6 +60,10 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry f_entry) noexcept;
 
+    /// @brief Set the number of larger memory pools which are tried when the best fitting one is exhausted
+    /// @param[in] number of larger memory pools to try, 0 disables the spill over
+    MePooConfig& setSpillOverMemPools(const uint32_t f_spillOverMemPools) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
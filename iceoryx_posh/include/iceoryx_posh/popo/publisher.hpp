@@ -57,6 +57,16 @@ class Publisher_t
     /// @return Payload of the chunk reserved
     virtual void* allocateChunk(uint32_t payloadSize, bool useDynamicPayloadSizes = false) noexcept;
 
+    /// @brief Allocate memory for chunk to be sent with a custom payload alignment and an optional user-header, e.g.
+    /// for SIMD or DMA friendly data; the user-header is available via ChunkHeader::userHeader
+    /// @param[in] payloadSize size of shared memory to be allocated
+    /// @param[in] chunkLayout alignment of the payload and size of the user-header
+    /// @param[in] useDynamicPayloadSizes bool value of using dynamic payload size
+    /// @return Payload of the chunk reserved
+    virtual void* allocateChunk(uint32_t payloadSize,
+                                const mepoo::ChunkLayout& chunkLayout,
+                                bool useDynamicPayloadSizes = false) noexcept;
+
     /// @brief Send the chunk and deliver it on subscription
     /// @param[in] chunkHeader Information about the chunk to be sent
     virtual void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -91,6 +101,13 @@ class Publisher_t
     /// @brief Enable the functionality to send the last chunk to new subscribers
     void enableDoDeliverOnSubscription() noexcept;
 
+    /// @brief Records the latencies of the chunks allocated from now on, from the allocation over the delivery to the
+    /// release by the subscribers; the latency histograms are published by the port introspection
+    void enableLatencyTracing() noexcept;
+
+    /// @brief Stops the recording of the latencies for the chunks allocated from now on
+    void disableLatencyTracing() noexcept;
+
   protected:
     // needed for unit testing
     Publisher_t() noexcept;
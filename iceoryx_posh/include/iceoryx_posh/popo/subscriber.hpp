@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/popo/receiver_port.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/timespec.hpp"
@@ -90,6 +91,13 @@ class Subscriber_t
     /// @return true when restart is needed on interruption by handler, false when timed out
     bool waitForChunk(const uint32_t timeoutMs) noexcept;
 
+    /// @brief Sets how waitForChunk waits, with polling it checks for new chunks before it blocks on the semaphore
+    /// and the sender does not post the semaphore meanwhile. The default blocks right away.
+    /// @param[in] waitStrategy number of spin and yield iterations before waitForChunk blocks
+    /// @note the semaphore must be the own one of the subscriber, i.e. not overridden with overrideCallbackReference,
+    /// and there must be no receive handler which waits on it
+    void setWaitStrategy(const WaitStrategy& waitStrategy) noexcept;
+
     /// @brief Function for try wait to receive a chunk
     /// @param[in] timeoutMs the time in Milliseconds to wait
     /// @return true on success otherwise false
@@ -168,6 +176,8 @@ class Subscriber_t
     std::atomic_bool m_callbackThreadPresent{false};
     std::atomic_bool m_callbackRunFlag{false};
     posix::Semaphore* m_callbackSemaphore{nullptr};
+
+    WaitStrategy m_waitStrategy;
 };
 
 // Default Subscriber
@@ -17,6 +17,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_waiter.hpp"
 #include "iceoryx_posh/popo/condition.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_utils/cxx/vector.hpp"
 
@@ -133,6 +134,11 @@ class WaitSet
     /// fulfilled
     ConditionVector wait() noexcept;
 
+    /// @brief Sets how wait and timedWait wait for a signalling condition. Polling avoids the wake up syscall on both
+    /// sides when the condition becomes true soon, at the cost of CPU time. The default blocks right away.
+    /// @param[in] waitStrategy number of spin and yield iterations before the WaitSet blocks
+    void setWaitStrategy(const WaitStrategy& waitStrategy) noexcept;
+
   protected:
     explicit WaitSet(cxx::not_null<ConditionVariableData* const>) noexcept;
 
@@ -0,0 +1,57 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Describes how a waiter waits for a notification. It polls for the given number of spin iterations, then
+/// yields the CPU between the polls for the given number of yield iterations and only then blocks in the kernel.
+/// While the waiter spins or yields, the notifier does not post the semaphore and saves the syscall. The default
+/// strategy blocks right away.
+class WaitStrategy
+{
+  public:
+    /// @brief Constructor
+    /// @param[in] spinIterations number of busy polls before the waiter starts to yield
+    /// @param[in] yieldIterations number of polls with a yield of the CPU inbetween before the waiter blocks
+    explicit WaitStrategy(const uint64_t spinIterations = 0U, const uint64_t yieldIterations = 0U) noexcept;
+
+    uint64_t getSpinIterations() const noexcept;
+    uint64_t getYieldIterations() const noexcept;
+
+    /// @brief true if the waiter blocks without polling at all
+    bool isBlockingOnly() const noexcept;
+
+    /// @brief Polls the predicate for the spin and then the yield iterations
+    /// @param[in] predicate callable returning true as soon as the waiter can stop to wait
+    /// @return true if the predicate became true, false if it was false for all iterations and the waiter must block
+    template <typename Predicate>
+    bool pollUntil(const Predicate& predicate) const noexcept;
+
+  private:
+    uint64_t m_spinIterations{0U};
+    uint64_t m_yieldIterations{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/wait_strategy.inl"
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
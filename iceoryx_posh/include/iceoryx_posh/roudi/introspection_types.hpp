@@ -38,6 +38,7 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_payloadSize{0};
+    uint32_t m_spilledChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -91,6 +92,16 @@ struct PortIntrospectionFieldTopic
     cxx::vector<SenderPortData, MAX_PUBLISHERS> m_senderList;
 };
 
+/// @brief histogram of the latencies of a tracing point of a port, the chunks are traced when the latency tracing of
+/// the sender port is enabled; see NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS for the range of the buckets
+struct LatencyHistogramData
+{
+    uint64_t m_buckets[NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS]{};
+    uint64_t m_count{0};
+    uint64_t m_sumInNanoseconds{0};
+    uint64_t m_maxInNanoseconds{0};
+};
+
 const capro::ServiceDescription
     IntrospectionPortThroughputService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortThroughput");
 
@@ -102,6 +113,8 @@ struct PortThroughputData
     double m_chunksPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    /// @brief time between the reservation and the delivery of the chunks
+    LatencyHistogramData m_allocateToSendLatency;
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -121,6 +134,12 @@ struct ReceiverPortChangingData
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     bool sampleSendCallbackActive{false};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    /// @brief time between the delivery by the sender and the push into the delivery FiFo
+    LatencyHistogramData sendToDeliverLatency;
+    /// @brief time between the delivery by the sender and the take of the chunk by the application
+    LatencyHistogramData sendToGetLatency;
+    /// @brief time between the delivery by the sender and the release of the chunk by the application
+    LatencyHistogramData sendToReleaseLatency;
 };
 
 struct ReceiverPortChangingIntrospectionFieldTopic
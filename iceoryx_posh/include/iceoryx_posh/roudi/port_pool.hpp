@@ -131,7 +131,15 @@ class PortPool
 
     std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
 
+    runtime::ServiceRegistryTable& serviceRegistryTable() noexcept;
+
+    /// @brief the trigger which is notified by the ports when they have something for the discovery
+    popo::DiscoveryTrigger& discoveryTrigger() noexcept;
+
   private:
+    void attachDiscoveryTrigger(popo::BasePortData* const portData,
+                                const popo::DiscoveryTrigger::PortKind portKind) noexcept;
+
     PortPoolData* m_portPoolData;
 };
 
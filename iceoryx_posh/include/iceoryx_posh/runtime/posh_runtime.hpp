@@ -46,6 +46,7 @@ namespace runtime
 {
 class Runnable;
 class RunnableData;
+class ServiceRegistryTable;
 
 constexpr char DEFAULT_RUNTIME_INSTANCE_NAME[] = "dummy";
 
@@ -159,6 +160,12 @@ class PoshRuntime
     /// @return true if sucessful request/response, false on error
     bool sendRequestToRouDi(const MqMessage& msg, MqMessage& answer) noexcept;
 
+    /// @brief send a binary request to the RouDi daemon and get the binary response
+    /// @param[in] msg request message to send
+    /// @param[out] answer response from RouDi
+    /// @return true if successful request/response, false on error
+    bool sendRequestToRouDi(const MqBinaryMessage& msg, MqBinaryMessage& answer) noexcept;
+
   public:
     PoshRuntime(const PoshRuntime&) = delete;
     PoshRuntime& operator=(const PoshRuntime&) = delete;
@@ -192,6 +199,21 @@ class PoshRuntime
     cxx::expected<popo::ConditionVariableData*, MqMessageErrorType>
     requestConditionVariableFromRoudi(const MqMessage& sendBuffer) noexcept;
 
+    /// @brief sends a binary port request to RouDi and returns the port from the ACK or the error from the ERROR
+    /// response
+    /// @param[in] sendBuffer the binary request
+    /// @param[in] expectedAck the message type of the ACK for this request
+    /// @param[in] wrongResponseError the error which is returned if neither the ACK nor an ERROR was received
+    template <typename PortDataType>
+    cxx::expected<PortDataType*, MqMessageErrorType> requestPortFromRoudi(
+        const MqBinaryMessage& sendBuffer,
+        const MqMessageType expectedAck,
+        const MqMessageErrorType wrongResponseError = MqMessageErrorType::NOTYPE) noexcept;
+
+    /// @brief requests the service registry table in the management segment from RouDi
+    /// @return nullptr if RouDi did not provide the table, then every look up is sent to RouDi
+    const ServiceRegistryTable* requestServiceRegistryTable() noexcept;
+
     /// @brief checks the given application name for certain constraints like length(100 chars) or leading slash
     /// @todo replace length check with fixedstring when its integrated
     const std::string& verifyInstanceName(const std::string& name) noexcept;
@@ -199,6 +221,9 @@ class PoshRuntime
     const std::string m_appName;
     mutable std::mutex m_appMqRequestMutex;
 
+    std::once_flag m_serviceRegistryTableOnceFlag;
+    const ServiceRegistryTable* m_serviceRegistryTable{nullptr};
+
     // Message queue interface for POSIX IPC from RouDi
     MqRuntimeInterface m_MqInterface;
     // Shared memory interface for POSIX IPC from RouDi
@@ -283,11 +283,21 @@ void ServiceDescription::setInternal() noexcept
     m_scope = Scope::INTERNAL;
 }
 
-Scope ServiceDescription::getScope() noexcept
+Scope ServiceDescription::getScope() const noexcept
 {
     return m_scope;
 }
 
+void ServiceDescription::setScope(const Scope scope) noexcept
+{
+    m_scope = scope;
+}
+
+void ServiceDescription::setServiceOnlyDescription() noexcept
+{
+    m_hasServiceOnlyDescription = true;
+}
+
 ServiceDescription::ClassHash ServiceDescription::getClassHash() const noexcept
 {
     return m_classHash;
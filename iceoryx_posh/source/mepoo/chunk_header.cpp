@@ -14,18 +14,64 @@
 
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_utils/cxx/helplets.hpp"
+
+#include <cstddef>
+#include <new>
 
 namespace iox
 {
 namespace mepoo
 {
+static_assert(alignof(ChunkHeader) == ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT,
+              "the default payload alignment must not require padding behind the ChunkHeader");
+static_assert(offsetof(ChunkHeader, m_payloadOffset) + sizeof(ChunkHeader::PayloadOffset_t) == sizeof(ChunkHeader),
+              "m_payloadOffset must be located right in front of a payload with the default layout");
+
 ChunkHeader::ChunkHeader() noexcept
 {
 }
 
+ChunkHeader::ChunkHeader(const ChunkLayout& layout) noexcept
+    : m_userHeaderSize(layout.m_userHeaderSize)
+    , m_payloadAlignment(layout.m_payloadAlignment)
+{
+    if (m_userHeaderSize == 0u && m_payloadAlignment <= alignof(ChunkHeader))
+    {
+        // the payload is located right behind the ChunkHeader
+        return;
+    }
+
+    const uint64_t addressOfChunkHeader = reinterpret_cast<uint64_t>(this);
+    const uint64_t endOfChunkHeader = addressOfChunkHeader + sizeof(ChunkHeader);
+
+    // without a user-header a padded payload has at least alignof(ChunkHeader) bytes in front of it to store the
+    // offset, with a user-header the offset needs to be placed explicitly behind it
+    const uint64_t earliestPayloadAddress =
+        (m_userHeaderSize == 0u) ? endOfChunkHeader
+                                 : endOfChunkHeader + m_userHeaderSize + sizeof(PayloadOffset_t);
+    const uint64_t payloadAddress = cxx::align(earliestPayloadAddress, static_cast<uint64_t>(m_payloadAlignment));
+    m_payloadOffset = static_cast<PayloadOffset_t>(payloadAddress - addressOfChunkHeader);
+    new (reinterpret_cast<void*>(payloadAddress - sizeof(PayloadOffset_t))) PayloadOffset_t(m_payloadOffset);
+}
+
+uint64_t ChunkHeader::requiredChunkSize(const uint32_t payloadSize, const ChunkLayout& layout) noexcept
+{
+    if (layout.m_userHeaderSize == 0u)
+    {
+        const uint64_t padding =
+            (layout.m_payloadAlignment > alignof(ChunkHeader)) ? layout.m_payloadAlignment - alignof(ChunkHeader) : 0u;
+        return sizeof(ChunkHeader) + padding + payloadSize;
+    }
+
+    return sizeof(ChunkHeader) + static_cast<uint64_t>(layout.m_userHeaderSize) + sizeof(PayloadOffset_t)
+           + layout.m_payloadAlignment - 1u + payloadSize;
+}
+
 ChunkHeader* convertPayloadPointerToChunkHeader(const void* const payload) noexcept
 {
-    return reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint64_t>(payload) - sizeof(ChunkHeader));
+    const auto payloadOffset = *(reinterpret_cast<const ChunkHeader::PayloadOffset_t*>(payload) - 1u);
+    return reinterpret_cast<ChunkHeader*>(reinterpret_cast<uint64_t>(payload) - payloadOffset);
 }
 
 } // namespace mepoo
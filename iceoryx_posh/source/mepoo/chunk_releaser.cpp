@@ -0,0 +1,95 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/chunk_releaser.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace mepoo
+{
+namespace
+{
+/// @brief sorts the chunk management entries by their mempool and frees the chunks of each mempool at once
+template <typename MemPoolOf, typename ChunkOf>
+void freeChunksSortedByMemPool(ChunkManagement** const f_chunkManagements,
+                               const uint32_t f_numberOfChunks,
+                               const MemPoolOf& f_memPoolOf,
+                               const ChunkOf& f_chunkOf)
+{
+    std::sort(f_chunkManagements,
+              f_chunkManagements + f_numberOfChunks,
+              [&](ChunkManagement* const lhs, ChunkManagement* const rhs) {
+                  return f_memPoolOf(lhs) < f_memPoolOf(rhs);
+              });
+
+    const void* chunks[MemPool::MAX_CHUNKS_PER_BATCH];
+    uint32_t first{0u};
+    while (first < f_numberOfChunks)
+    {
+        MemPool* memPool = f_memPoolOf(f_chunkManagements[first]);
+        uint32_t numberOfChunks{0u};
+        while (first + numberOfChunks < f_numberOfChunks
+               && f_memPoolOf(f_chunkManagements[first + numberOfChunks]) == memPool)
+        {
+            chunks[numberOfChunks] = f_chunkOf(f_chunkManagements[first + numberOfChunks]);
+            ++numberOfChunks;
+        }
+        memPool->freeChunks(chunks, numberOfChunks);
+        first += numberOfChunks;
+    }
+}
+} // namespace
+
+ChunkReleaser::~ChunkReleaser()
+{
+    flush();
+}
+
+void ChunkReleaser::release(SharedChunk&& f_chunk)
+{
+    ChunkManagement* chunkManagement = f_chunk.release();
+    if ((chunkManagement != nullptr)
+        && (chunkManagement->m_referenceCounter.fetch_sub(1u, std::memory_order_relaxed) == 1u))
+    {
+        m_chunkManagements[m_numberOfChunks] = chunkManagement;
+        ++m_numberOfChunks;
+
+        if (m_numberOfChunks == MemPool::MAX_CHUNKS_PER_BATCH)
+        {
+            flush();
+        }
+    }
+}
+
+void ChunkReleaser::flush()
+{
+    // the chunk management is needed to find the payload, therefore it is freed last
+    freeChunksSortedByMemPool(
+        m_chunkManagements,
+        m_numberOfChunks,
+        [](ChunkManagement* const chunkManagement) { return chunkManagement->m_mempool.get(); },
+        [](ChunkManagement* const chunkManagement) -> const void* { return chunkManagement->m_chunkHeader.get(); });
+    freeChunksSortedByMemPool(
+        m_chunkManagements,
+        m_numberOfChunks,
+        [](ChunkManagement* const chunkManagement) { return chunkManagement->m_chunkManagementPool.get(); },
+        [](ChunkManagement* const chunkManagement) -> const void* { return chunkManagement; });
+
+    m_numberOfChunks = 0u;
+}
+
+} // namespace mepoo
+} // namespace iox
@@ -30,6 +30,7 @@ MemPool::MemPool(const cxx::greater_or_equal<uint32_t, MEMORY_ALIGNMENT> f_chunk
                  posix::Allocator* f_payloadAllocator)
     : m_chunkSize(f_chunkSize)
     , m_numberOfChunks(f_numberOfChunks)
+    , m_freeChunks(f_numberOfChunks)
     , m_minFree(f_numberOfChunks)
 {
     if (isMultipleOfAlignment(f_chunkSize))
@@ -53,47 +54,152 @@ bool MemPool::isMultipleOfAlignment(const uint32_t value) const
     return (value % SHARED_MEMORY_ALIGNMENT == 0u);
 }
 
-void MemPool::adjustMinFree()
+void MemPool::adjustMinFree(const int64_t f_freeChunks)
 {
-    // @todo rethink the concurrent change that can happen. do we need a CAS loop?
-    m_minFree.store(std::min(m_numberOfChunks - m_usedChunks.load(std::memory_order_relaxed),
-                             m_minFree.load(std::memory_order_relaxed)));
+    const uint32_t freeChunks = static_cast<uint32_t>(std::max(f_freeChunks, static_cast<int64_t>(0)));
+
+    // m_minFree is only written when a new minimum is reached, the CAS ensures that a concurrent and smaller minimum
+    // is never overwritten
+    uint32_t minFree = m_minFree.load(std::memory_order_relaxed);
+    while (freeChunks < minFree
+           && !m_minFree.compare_exchange_weak(minFree, freeChunks, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint32_t MemPool::usedChunksFromFreeChunks(const int64_t f_freeChunks) const
+{
+    return m_numberOfChunks - static_cast<uint32_t>(std::max(f_freeChunks, static_cast<int64_t>(0)));
 }
 
 void* MemPool::getChunk()
+{
+    void* chunk = tryGetChunk();
+    if (chunk == nullptr)
+    {
+        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                  << ", used_chunks = " << getUsedChunks() << " ] has no more space left" << std::endl;
+    }
+    return chunk;
+}
+
+void* MemPool::tryGetChunk()
 {
     uint32_t l_index{0u};
+    // the chunk is reserved before it is taken from the free list and returned after it was handed back to the free
+    // list, therefore m_freeChunks never exceeds the number of chunks in the free list; a chunk which is freed
+    // concurrently is already in the free list but not yet counted, the watermark might be too low but never too high
+    const int64_t freeChunks = m_freeChunks.fetch_sub(1, std::memory_order_relaxed) - 1;
     if (!m_freeIndices.pop(l_index))
     {
-        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+        m_freeChunks.fetch_add(1, std::memory_order_relaxed);
+        adjustMinFree(0);
+        m_reclaimRequests.fetch_add(1u, std::memory_order_relaxed);
         return nullptr;
     }
 
-    /// @todo: verify that m_usedChunk is not changed during adjustMInFree
-    ///         without changing m_minFree
-    m_usedChunks.fetch_add(1u, std::memory_order_relaxed);
-    adjustMinFree();
+    adjustMinFree(freeChunks);
 
     return m_rawMemory + l_index * m_chunkSize;
 }
 
-void MemPool::freeChunk(const void* chunk)
+uint32_t MemPool::getChunks(void** const f_chunks, const uint32_t f_numberOfChunks)
 {
-    cxx::Expects(m_rawMemory <= chunk
-                 && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1u)));
+    const int64_t freeChunks = m_freeChunks.fetch_sub(f_numberOfChunks, std::memory_order_relaxed) - f_numberOfChunks;
+    uint32_t numberOfAcquiredChunks{0u};
+    uint32_t l_indices[MAX_CHUNKS_PER_BATCH];
+    while (numberOfAcquiredChunks < f_numberOfChunks)
+    {
+        const uint32_t batchSize =
+            std::min(f_numberOfChunks - numberOfAcquiredChunks, static_cast<uint32_t>(MAX_CHUNKS_PER_BATCH));
+        const uint32_t numberOfIndices = m_freeIndices.popN(l_indices, batchSize);
+        for (uint32_t i = 0u; i < numberOfIndices; ++i)
+        {
+            f_chunks[numberOfAcquiredChunks] = m_rawMemory + l_indices[i] * m_chunkSize;
+            ++numberOfAcquiredChunks;
+        }
+
+        if (numberOfIndices < batchSize)
+        {
+            break;
+        }
+    }
 
-    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
-    cxx::Expects(offset % m_chunkSize == 0);
+    if (numberOfAcquiredChunks < f_numberOfChunks)
+    {
+        // the free list ran empty
+        m_freeChunks.fetch_add(f_numberOfChunks - numberOfAcquiredChunks, std::memory_order_relaxed);
+        adjustMinFree(0);
+        m_reclaimRequests.fetch_add(1u, std::memory_order_relaxed);
+    }
+    else
+    {
+        adjustMinFree(freeChunks);
+    }
+
+    return numberOfAcquiredChunks;
+}
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+void MemPool::freeChunk(const void* chunk)
+{
+    uint32_t index = indexOfChunk(chunk);
 
-    if (!m_freeIndices.push(index))
+    if (m_freeIndices.push(index))
+    {
+        m_freeChunks.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
     {
         errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
     }
+}
 
-    m_usedChunks.fetch_sub(1u, std::memory_order_relaxed);
+void MemPool::freeChunks(const void* const* const f_chunks, const uint32_t f_numberOfChunks)
+{
+    uint32_t numberOfFreedChunks{0u};
+    uint32_t l_indices[MAX_CHUNKS_PER_BATCH];
+    while (numberOfFreedChunks < f_numberOfChunks)
+    {
+        const uint32_t batchSize =
+            std::min(f_numberOfChunks - numberOfFreedChunks, static_cast<uint32_t>(MAX_CHUNKS_PER_BATCH));
+        for (uint32_t i = 0u; i < batchSize; ++i)
+        {
+            l_indices[i] = indexOfChunk(f_chunks[numberOfFreedChunks + i]);
+        }
+
+        // the batch is rejected as a whole if it contains an invalid chunk, push the chunks one by one to find it
+        if (m_freeIndices.pushN(l_indices, batchSize))
+        {
+            m_freeChunks.fetch_add(batchSize, std::memory_order_relaxed);
+        }
+        else
+        {
+            for (uint32_t i = 0u; i < batchSize; ++i)
+            {
+                if (m_freeIndices.push(l_indices[i]))
+                {
+                    m_freeChunks.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+                }
+            }
+        }
+
+        numberOfFreedChunks += batchSize;
+    }
+}
+
+uint32_t MemPool::indexOfChunk(const void* chunk) const
+{
+    cxx::Expects(m_rawMemory <= chunk
+                 && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1u)));
+
+    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
+    cxx::Expects(offset % m_chunkSize == 0);
+
+    return static_cast<uint32_t>(offset / m_chunkSize);
 }
 
 uint32_t MemPool::getChunkSize() const
@@ -108,7 +214,7 @@ uint32_t MemPool::getChunkCount() const
 
 uint32_t MemPool::getUsedChunks() const
 {
-    return m_usedChunks.load(std::memory_order_relaxed);
+    return usedChunksFromFreeChunks(m_freeChunks.load(std::memory_order_relaxed));
 }
 
 uint32_t MemPool::getMinFree() const
@@ -116,12 +222,28 @@ uint32_t MemPool::getMinFree() const
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint32_t MemPool::getSpilledChunks() const
+{
+    return m_spilledChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::recordSpillOver(const uint32_t f_numberOfChunks)
+{
+    m_spilledChunks.fetch_add(f_numberOfChunks, std::memory_order_relaxed);
+}
+
+uint64_t MemPool::getReclaimRequests() const
+{
+    return m_reclaimRequests.load(std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
+    return {getUsedChunks(),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_spilledChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
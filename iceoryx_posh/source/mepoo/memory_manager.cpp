@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -90,16 +91,86 @@ MemPoolInfo MemoryManager::getMemPoolInfo(uint32_t index) const
 uint32_t MemoryManager::getMempoolChunkSizeForPayloadSize(const uint32_t f_size) const
 {
     uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
-    for (auto& memPool : m_memPoolVector)
+    const auto index = getMemPoolIndexForChunkSize(adjustedSize);
+    if (index < m_memPoolVector.size())
     {
-        const auto chunkSize = memPool.getChunkSize();
-        if (chunkSize >= adjustedSize)
+        return m_memPoolVector[index].getChunkSize();
+    }
+
+    return 0;
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint32_t f_size) noexcept
+{
+    if (f_size <= 1u)
+    {
+        return 0u;
+    }
+
+    // the size class is ceil(log2(f_size)) which is floor(log2(f_size - 1)) + 1
+    uint32_t value = f_size - 1u;
+    uint32_t sizeClass = 1u;
+    for (uint32_t shift = 16u; shift > 0u; shift >>= 1u)
+    {
+        if (value >= (1u << shift))
         {
-            return chunkSize;
+            value >>= shift;
+            sizeClass += shift;
         }
     }
+    return sizeClass;
+}
 
-    return 0;
+uint32_t MemoryManager::getMemPoolIndexForChunkSize(const uint32_t f_chunkSize) const noexcept
+{
+    const uint32_t sizeClass = sizeClassOf(f_chunkSize);
+    uint32_t index = m_sizeClassLookup[sizeClass];
+    uint32_t numberOfCandidates = m_sizeClassLookup[sizeClass + 1u] - index;
+
+    // the mempools are ordered by increasing chunk size, a binary search for the first one of the size class which is
+    // large enough; if there is none, the first mempool of the next size class fits
+    while (numberOfCandidates > 0u)
+    {
+        const uint32_t half = numberOfCandidates / 2u;
+        if (m_chunkSizes[index + half] < f_chunkSize)
+        {
+            index += half + 1u;
+            numberOfCandidates -= half + 1u;
+        }
+        else
+        {
+            numberOfCandidates = half;
+        }
+    }
+    return index;
+}
+
+void MemoryManager::generateSizeClassLookup() noexcept
+{
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    for (uint32_t i = 0u; i < numberOfMemPools; ++i)
+    {
+        m_chunkSizes[i] = m_memPoolVector[i].getChunkSize();
+    }
+
+    uint32_t index = 0u;
+    for (uint32_t sizeClass = 0u; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        // smallest size of the size class
+        const uint64_t lowerBound = (sizeClass == 0u) ? 0u : (1ull << (sizeClass - 1u)) + 1u;
+        while (index < numberOfMemPools && m_chunkSizes[index] < lowerBound)
+        {
+            ++index;
+        }
+        m_sizeClassLookup[sizeClass] = index;
+    }
+    m_sizeClassLookup[NUMBER_OF_SIZE_CLASSES] = numberOfMemPools;
+}
+
+uint32_t MemoryManager::getLastSpillOverMemPoolIndex(const uint32_t f_index) const noexcept
+{
+    return static_cast<uint32_t>(std::min(static_cast<uint64_t>(f_index) + m_spillOverMemPools,
+                                          static_cast<uint64_t>(m_memPoolVector.size()) - 1u));
 }
 
 uint32_t MemoryManager::sizeWithChunkHeaderStruct(const MaxSize_t f_size)
@@ -149,26 +220,47 @@ void MemoryManager::configureMemoryManager(const MePooConfig& f_mePooConfig,
     {
         addMemPool(f_managementAllocator, f_payloadAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_spillOverMemPools = f_mePooConfig.m_spillOverMemPools;
 
+    generateSizeClassLookup();
     generateChunkManagementPool(f_managementAllocator);
 }
 
-SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
+SharedChunk MemoryManager::getChunk(const MaxSize_t f_size, const ChunkLayout& f_layout)
 {
+    if (f_layout.m_payloadAlignment == 0u || (f_layout.m_payloadAlignment & (f_layout.m_payloadAlignment - 1u)) != 0u)
+    {
+        std::cerr << "MemoryManager: the payload alignment " << f_layout.m_payloadAlignment
+                  << " is not a power of two" << std::endl;
+        errorHandler(Error::kMEPOO__MEMPOOL_GETCHUNK_INVALID_PAYLOAD_ALIGNMENT, nullptr, ErrorLevel::MODERATE);
+        return SharedChunk(nullptr);
+    }
+
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
-    uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
-    uint32_t totalSizeOfAquiredChunk = 0;
+    // a chunk size beyond the range of uint32_t does not fit into any mempool
+    const uint64_t adjustedSize = std::min(ChunkHeader::requiredChunkSize(f_size, f_layout),
+                                           static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()));
 
-    for (auto& memPool : m_memPoolVector)
+    const auto index = getMemPoolIndexForChunkSize(static_cast<uint32_t>(adjustedSize));
+    if (index < m_memPoolVector.size())
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= adjustedSize)
+        auto& memPool = m_memPoolVector[index];
+        chunk = memPool.tryGetChunk();
+        memPoolPointer = &memPool;
+
+        // the best fitting mempool is exhausted, try to get a chunk from the next larger ones
+        const uint32_t lastSpillOverIndex = getLastSpillOverMemPoolIndex(index);
+        for (uint32_t spillOverIndex = index + 1u; chunk == nullptr && spillOverIndex <= lastSpillOverIndex;
+             ++spillOverIndex)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            totalSizeOfAquiredChunk = chunkSizeOfMemPool;
-            break;
+            auto& spillOverMemPool = m_memPoolVector[spillOverIndex];
+            chunk = spillOverMemPool.tryGetChunk();
+            if (chunk != nullptr)
+            {
+                memPool.recordSpillOver();
+                memPoolPointer = &spillOverMemPool;
+            }
         }
     }
 
@@ -183,6 +275,11 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
     }
     else if (chunk == nullptr)
     {
+        // only reported when also the spill over mempools are exhausted
+        std::cerr << "Mempool [m_chunkSize = " << m_memPoolVector[index].getChunkSize()
+                  << ", numberOfChunks = " << m_memPoolVector[index].getChunkCount()
+                  << ", used_chunks = " << m_memPoolVector[index].getUsedChunks() << " ] has no more space left"
+                  << std::endl;
         std::cerr << "MemoryManager: unable to acquire a chunk with a payload size of " << f_size << std::endl;
         std::cerr << "The following mempools are available:" << std::endl;
         printMemPoolVector();
@@ -190,15 +287,89 @@ SharedChunk MemoryManager::getChunk(const MaxSize_t f_size)
     }
     else
     {
-        new (chunk) ChunkHeader();
-        static_cast<ChunkHeader*>(chunk)->m_info.m_payloadSize = f_size;
-        static_cast<ChunkHeader*>(chunk)->m_info.m_usedSizeOfChunk = adjustedSize;
-        static_cast<ChunkHeader*>(chunk)->m_info.m_totalSizeOfChunk = totalSizeOfAquiredChunk;
-        ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool.front().getChunk());
-        new (chunkManagement)
-            ChunkManagement(static_cast<ChunkHeader*>(chunk), memPoolPointer, &m_chunkManagementPool.front());
-        return SharedChunk(chunkManagement);
+        return createSharedChunk(chunk, *memPoolPointer, f_size, f_layout);
     }
 }
+
+uint32_t MemoryManager::getChunks(const MaxSize_t f_size, SharedChunk* const f_chunks, const uint32_t f_numberOfChunks)
+{
+    uint32_t adjustedSize = MemoryManager::sizeWithChunkHeaderStruct(f_size);
+
+    const auto index = getMemPoolIndexForChunkSize(adjustedSize);
+    if (index >= m_memPoolVector.size())
+    {
+        return 0u;
+    }
+
+    auto& bestFittingMemPool = m_memPoolVector[index];
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+    uint32_t numberOfAcquiredChunks{0u};
+    void* chunks[MemPool::MAX_CHUNKS_PER_BATCH];
+    void* chunkManagements[MemPool::MAX_CHUNKS_PER_BATCH];
+    // the best fitting mempool is used first, when it is exhausted the next larger ones like in getChunk
+    const uint32_t lastSpillOverIndex = getLastSpillOverMemPoolIndex(index);
+    for (uint32_t memPoolIndex = index;
+         memPoolIndex <= lastSpillOverIndex && numberOfAcquiredChunks < f_numberOfChunks;
+         ++memPoolIndex)
+    {
+        auto& memPool = m_memPoolVector[memPoolIndex];
+        while (numberOfAcquiredChunks < f_numberOfChunks)
+        {
+            const uint32_t batchSize = std::min(f_numberOfChunks - numberOfAcquiredChunks,
+                                                static_cast<uint32_t>(MemPool::MAX_CHUNKS_PER_BATCH));
+            // the chunk management entries are acquired in a batch as well, a batch of chunks therefore needs a single
+            // operation on each of the two free lists
+            uint32_t numberOfChunksInBatch = memPool.getChunks(chunks, batchSize);
+            const uint32_t numberOfChunkManagements =
+                chunkManagementPool.getChunks(chunkManagements, numberOfChunksInBatch);
+            if (numberOfChunkManagements < numberOfChunksInBatch)
+            {
+                memPool.freeChunks(chunks + numberOfChunkManagements, numberOfChunksInBatch - numberOfChunkManagements);
+                numberOfChunksInBatch = numberOfChunkManagements;
+            }
+
+            for (uint32_t i = 0u; i < numberOfChunksInBatch; ++i)
+            {
+                f_chunks[numberOfAcquiredChunks] =
+                    createSharedChunk(chunks[i], chunkManagements[i], memPool, f_size, ChunkLayout());
+                ++numberOfAcquiredChunks;
+            }
+            if (memPoolIndex != index && numberOfChunksInBatch > 0u)
+            {
+                bestFittingMemPool.recordSpillOver(numberOfChunksInBatch);
+            }
+
+            if (numberOfChunksInBatch < batchSize)
+            {
+                break;
+            }
+        }
+    }
+
+    return numberOfAcquiredChunks;
+}
+
+SharedChunk MemoryManager::createSharedChunk(void* const f_chunk,
+                                             MemPool& f_memPool,
+                                             const uint32_t f_payloadSize,
+                                             const ChunkLayout& f_layout)
+{
+    return createSharedChunk(f_chunk, m_chunkManagementPool.front().getChunk(), f_memPool, f_payloadSize, f_layout);
+}
+
+SharedChunk MemoryManager::createSharedChunk(void* const f_chunk,
+                                             void* const f_chunkManagement,
+                                             MemPool& f_memPool,
+                                             const uint32_t f_payloadSize,
+                                             const ChunkLayout& f_layout)
+{
+    auto chunkHeader = new (f_chunk) ChunkHeader(f_layout);
+    chunkHeader->m_info.m_payloadSize = f_payloadSize;
+    chunkHeader->m_info.m_usedSizeOfChunk = chunkHeader->m_payloadOffset + f_payloadSize;
+    chunkHeader->m_info.m_totalSizeOfChunk = f_memPool.getChunkSize();
+    ChunkManagement* chunkManagement = static_cast<ChunkManagement*>(f_chunkManagement);
+    new (chunkManagement) ChunkManagement(chunkHeader, &f_memPool, &m_chunkManagementPool.front());
+    return SharedChunk(chunkManagement);
+}
 } // namespace mepoo
 } // namespace iox
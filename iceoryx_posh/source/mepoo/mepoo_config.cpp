@@ -38,6 +38,12 @@ void MePooConfig::addMemPool(MePooConfig::Entry f_entry) noexcept
     }
 }
 
+MePooConfig& MePooConfig::setSpillOverMemPools(const uint32_t f_spillOverMemPools) noexcept
+{
+    m_spillOverMemPools = f_spillOverMemPools;
+    return *this;
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
@@ -130,6 +130,22 @@ bool SharedChunk::hasNoOtherOwners() const
     return m_chunkManagement->m_referenceCounter.load(std::memory_order_relaxed) == 1u;
 }
 
+void SharedChunk::shareWith(const uint64_t f_numberOfOwners,
+                            const cxx::function_ref<void(SharedChunk&&)> f_takeOwner) const
+{
+    if (m_chunkManagement == nullptr || f_numberOfOwners == 0u)
+    {
+        return;
+    }
+
+    m_chunkManagement->m_referenceCounter.fetch_add(f_numberOfOwners, std::memory_order_relaxed);
+    for (uint64_t i = 0u; i < f_numberOfOwners; ++i)
+    {
+        // the owner adopts one of the references which were acquired above
+        f_takeOwner(SharedChunk(m_chunkManagement));
+    }
+}
+
 SharedChunk::operator bool() const
 {
     return m_chunkManagement != nullptr;
@@ -26,7 +26,12 @@ ConditionVariableSignaler::ConditionVariableSignaler(
 
 void ConditionVariableSignaler::notifyOne() noexcept
 {
-    getMembers()->m_semaphore.post();
+    getMembers()->m_wasNotified.store(true);
+    // a polling waiter sees the flag, the syscall of the post is only required for a blocked one
+    if (!getMembers()->m_isWaiterPolling.load())
+    {
+        getMembers()->m_semaphore.post();
+    }
 }
 
 const ConditionVariableData* ConditionVariableSignaler::getMembers() const noexcept
@@ -26,6 +26,7 @@ ConditionVariableWaiter::ConditionVariableWaiter(cxx::not_null<ConditionVariable
 
 void ConditionVariableWaiter::reset() noexcept
 {
+    getMembers()->m_wasNotified.store(false);
     // Count the semaphore down to zero
     while (getMembers()->m_semaphore.tryWait())
     {
@@ -34,14 +35,70 @@ void ConditionVariableWaiter::reset() noexcept
 
 void ConditionVariableWaiter::wait() noexcept
 {
+    if (pollForNotification())
+    {
+        return;
+    }
+
     getMembers()->m_semaphore.wait();
+    // the notification was consumed with the semaphore, later ones are posted since the waiter does not poll
+    getMembers()->m_wasNotified.store(false);
 }
 
 bool ConditionVariableWaiter::timedWait(units::Duration timeToWait) noexcept
 {
+    // the timeout is absolute, therefore the time spent with polling counts into the time to wait
     auto timeout = timeToWait.timespec(units::TimeSpecReference::Epoch);
+    if (pollForNotification())
+    {
+        return true;
+    }
+
     auto continueOnInterrupt{false};
-    return getMembers()->m_semaphore.timedWait(&timeout, continueOnInterrupt);
+    if (!getMembers()->m_semaphore.timedWait(&timeout, continueOnInterrupt))
+    {
+        return false;
+    }
+    getMembers()->m_wasNotified.store(false);
+    return true;
+}
+
+void ConditionVariableWaiter::setWaitStrategy(const WaitStrategy& waitStrategy) noexcept
+{
+    m_waitStrategy = waitStrategy;
+}
+
+bool ConditionVariableWaiter::pollForNotification() noexcept
+{
+    if (m_waitStrategy.isBlockingOnly())
+    {
+        return false;
+    }
+
+    auto& wasNotified = getMembers()->m_wasNotified;
+    auto consumeNotification = [&wasNotified] {
+        // the load avoids that the cache line bounces between waiter and signaler while nothing happens
+        return wasNotified.load(std::memory_order_relaxed) && wasNotified.exchange(false);
+    };
+
+    getMembers()->m_isWaiterPolling.store(true);
+    bool hasNotification = m_waitStrategy.pollUntil(consumeNotification);
+    // a signaler which still saw the polling flag did not post, but its notification is visible after the flag
+    // was reset since both are sequentially consistent
+    getMembers()->m_isWaiterPolling.store(false);
+    hasNotification = hasNotification || consumeNotification();
+
+    if (hasNotification)
+    {
+        // a signaler which did not see the polling flag also posted the semaphore, the notification was already
+        // consumed through the flag and the post would wake up the next wait for nothing. Draining is safe since
+        // every signaler sets the flag before it posts, a drained notification is either consumed here or still in
+        // the flag for the next poll.
+        while (getMembers()->m_semaphore.tryWait())
+        {
+        }
+    }
+    return hasNotification;
 }
 
 const ConditionVariableData* ConditionVariableWaiter::getMembers() const noexcept
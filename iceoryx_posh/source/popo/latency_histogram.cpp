@@ -0,0 +1,75 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
+
+namespace iox
+{
+namespace popo
+{
+void LatencyHistogram::recordSince(const mepoo::TimePointNs start) noexcept
+{
+    record(mepoo::BaseClock::now() - start);
+}
+
+void LatencyHistogram::record(const mepoo::DurationNs latency) noexcept
+{
+    const uint64_t latencyInNanoseconds = (latency.count() > 0) ? static_cast<uint64_t>(latency.count()) : 0U;
+
+    // there could be more than one application thread which uses the port, therefore the counters are atomic
+    m_buckets[bucketIndex(latencyInNanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+    m_sumInNanoseconds.fetch_add(latencyInNanoseconds, std::memory_order_relaxed);
+    m_count.fetch_add(1U, std::memory_order_relaxed);
+
+    uint64_t max = m_maxInNanoseconds.load(std::memory_order_relaxed);
+    while (latencyInNanoseconds > max
+           && !m_maxInNanoseconds.compare_exchange_weak(max, latencyInNanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint32_t LatencyHistogram::bucketIndex(const uint64_t latencyInNanoseconds) noexcept
+{
+    uint64_t latencyInMicroseconds = latencyInNanoseconds / 1000U;
+    uint32_t index = 0U;
+    while (latencyInMicroseconds > 0U && index < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS - 1U)
+    {
+        latencyInMicroseconds >>= 1U;
+        ++index;
+    }
+    return index;
+}
+
+uint64_t LatencyHistogram::getBucket(const uint32_t index) const noexcept
+{
+    return (index < NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS) ? m_buckets[index].load(std::memory_order_relaxed) : 0U;
+}
+
+uint64_t LatencyHistogram::getCount() const noexcept
+{
+    return m_count.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getSumInNanoseconds() const noexcept
+{
+    return m_sumInNanoseconds.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::getMaxInNanoseconds() const noexcept
+{
+    return m_maxInNanoseconds.load(std::memory_order_relaxed);
+}
+
+} // namespace popo
+} // namespace iox
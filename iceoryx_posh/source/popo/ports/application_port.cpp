@@ -36,6 +36,17 @@ void ApplicationPort::dispatchCaProMessage(const capro::CaproMessage& caProMessa
         // information loss from application to RouDi daemon
         errorHandler(Error::kPOPO__APPLICATION_PORT_QUEUE_OVERFLOW, nullptr, ErrorLevel::SEVERE);
     }
+    notifyDiscovery();
+}
+
+void ApplicationPort::sendKeepAlive() noexcept
+{
+    getMembers()->m_keepAliveCounter.fetch_add(1u, std::memory_order_relaxed);
+}
+
+uint64_t ApplicationPort::getKeepAliveCounter() const noexcept
+{
+    return getMembers()->m_keepAliveCounter.load(std::memory_order_relaxed);
 }
 
 const typename ApplicationPort::MemberType_t* ApplicationPort::getMembers() const noexcept
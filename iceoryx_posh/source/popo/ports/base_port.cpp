@@ -61,6 +61,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -68,5 +69,13 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    if (getMembers()->m_discoveryTrigger)
+    {
+        getMembers()->m_discoveryTrigger->notify(getMembers()->m_discoveryPortKind);
+    }
+}
+
 } // namespace popo
 } // namespace iox
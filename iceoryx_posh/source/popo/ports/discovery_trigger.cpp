@@ -0,0 +1,62 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/ports/discovery_trigger.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_signaler.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_waiter.hpp"
+
+namespace iox
+{
+namespace popo
+{
+constexpr DiscoveryTrigger::PortKinds_t DiscoveryTrigger::ALL_PORT_KINDS;
+
+void DiscoveryTrigger::notify(const PortKind portKind) noexcept
+{
+    // the release pairs with the acquire in takeNotifiedPortKinds, RouDi then sees the change of the port
+    const auto previousPortKinds =
+        m_notifiedPortKinds.fetch_or(static_cast<PortKinds_t>(portKind), std::memory_order_acq_rel);
+
+    // if there were already notified port kinds, RouDi is already woken up and did not yet take them
+    if (previousPortKinds == 0u)
+    {
+        ConditionVariableSignaler(&m_conditionVariableData).notifyOne();
+    }
+}
+
+bool DiscoveryTrigger::timedWait(const units::Duration timeout) noexcept
+{
+    if (m_notifiedPortKinds.load(std::memory_order_relaxed) != 0u)
+    {
+        return true;
+    }
+
+    // a wake up might be from a notification whose port kinds were already taken, therefore the port kinds are
+    // checked again
+    ConditionVariableWaiter(&m_conditionVariableData).timedWait(timeout);
+    return m_notifiedPortKinds.load(std::memory_order_relaxed) != 0u;
+}
+
+DiscoveryTrigger::PortKinds_t DiscoveryTrigger::takeNotifiedPortKinds() noexcept
+{
+    return m_notifiedPortKinds.exchange(0u, std::memory_order_acq_rel);
+}
+
+bool DiscoveryTrigger::contains(const PortKinds_t portKinds, const PortKind portKind) noexcept
+{
+    return (portKinds & static_cast<PortKinds_t>(portKind)) != 0u;
+}
+
+} // namespace popo
+} // namespace iox
@@ -36,9 +36,9 @@ PublisherPortUser::MemberType_t* PublisherPortUser::getMembers() noexcept
 }
 
 cxx::expected<mepoo::ChunkHeader*, AllocationError>
-PublisherPortUser::tryAllocateChunk(const uint32_t payloadSize) noexcept
+PublisherPortUser::tryAllocateChunk(const uint32_t payloadSize, const mepoo::ChunkLayout& chunkLayout) noexcept
 {
-    return m_chunkSender.tryAllocate(payloadSize, getUniqueID());
+    return m_chunkSender.tryAllocate(payloadSize, getUniqueID(), chunkLayout);
 }
 
 void PublisherPortUser::freeChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
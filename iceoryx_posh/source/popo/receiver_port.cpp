@@ -167,6 +167,7 @@ void ReceiverPort::subscribe(const uint32_t f_deliverySize)
         getMembers()->m_deliveryFiFo.resize(f_deliverySize);
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -175,6 +176,7 @@ void ReceiverPort::unsubscribe()
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -205,6 +207,10 @@ bool ReceiverPort::getChunk(const mepoo::ChunkHeader*& f_chunkHeader) noexcept
         if (getMembers()->m_deliveredChunkList.insert(l_chunk))
         {
             f_chunkHeader = l_chunk.getChunkHeader();
+            if (f_chunkHeader->m_info.m_isLatencyTraced)
+            {
+                getMembers()->m_sendToGetLatency.recordSince(f_chunkHeader->m_info.m_txTimestamp);
+            }
             return true;
         }
         else
@@ -239,6 +245,10 @@ bool ReceiverPort::releaseChunk(const mepoo::ChunkHeader* f_chunkHeader)
 
     if (getMembers()->m_deliveredChunkList.remove(f_chunkHeader, l_chunk))
     {
+        if (f_chunkHeader->m_info.m_isLatencyTraced)
+        {
+            getMembers()->m_sendToReleaseLatency.recordSince(f_chunkHeader->m_info.m_txTimestamp);
+        }
         return true;
     }
     else
@@ -321,6 +331,11 @@ bool ReceiverPort::deliver(mepoo::SharedChunk f_chunk_p) noexcept
         return false;
     }
 
+    // f_chunk_p is empty after it was moved into the FiFo
+    const mepoo::ChunkInfo& chunkInfo = f_chunk_p.getChunkHeader()->m_info;
+    const bool isLatencyTraced = chunkInfo.m_isLatencyTraced;
+    const mepoo::TimePointNs sendTimestamp = chunkInfo.m_txTimestamp;
+
     mepoo::SharedChunk l_chunk{nullptr};
 
     if (getMembers()->m_deliveryFiFo.push(std::move(f_chunk_p), l_chunk) && getMembers()->m_notifyOverflow)
@@ -336,11 +351,20 @@ bool ReceiverPort::deliver(mepoo::SharedChunk f_chunk_p) noexcept
             ErrorLevel::MODERATE);
     }
 
+    if (isLatencyTraced)
+    {
+        getMembers()->m_sendToDeliverLatency.recordSince(sendTimestamp);
+    }
+
     // check for registered event callback handler - trigger if existing
     // note that we also call in the overflow case of a push above
     if (getMembers()->m_chunkSendCallbackActive.load(std::memory_order_acquire))
     {
-        if (getMembers()->m_chunkSendSemaphore != nullptr)
+        // pairs with the fence in setWaiterPolling, either the waiter sees the chunk after the polling or the flag
+        // is seen as reset here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (getMembers()->m_chunkSendSemaphore != nullptr
+            && !getMembers()->m_isWaiterPolling.load(std::memory_order_relaxed))
         {
             getMembers()->m_chunkSendSemaphore->post();
         }
@@ -349,6 +373,12 @@ bool ReceiverPort::deliver(mepoo::SharedChunk f_chunk_p) noexcept
     return true;
 }
 
+void ReceiverPort::setWaiterPolling(const bool isPolling) noexcept
+{
+    getMembers()->m_isWaiterPolling.store(isPolling, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
 uint64_t ReceiverPort::getDeliveryFiFoCapacity() const
 {
     return getMembers()->m_deliveryFiFo.getCapacity();
@@ -369,5 +399,20 @@ const ReceiverPort::MemoryInfo& ReceiverPort::getMemoryInfo() const noexcept
     return getMembers()->m_memoryInfo;
 }
 
+const LatencyHistogram& ReceiverPort::getSendToDeliverLatency() const noexcept
+{
+    return getMembers()->m_sendToDeliverLatency;
+}
+
+const LatencyHistogram& ReceiverPort::getSendToGetLatency() const noexcept
+{
+    return getMembers()->m_sendToGetLatency;
+}
+
+const LatencyHistogram& ReceiverPort::getSendToReleaseLatency() const noexcept
+{
+    return getMembers()->m_sendToReleaseLatency;
+}
+
 } // namespace popo
 } // namespace iox
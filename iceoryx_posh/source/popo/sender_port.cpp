@@ -112,6 +112,13 @@ void SenderPort::setThroughput(const uint32_t payloadSize)
 }
 
 mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool useDynamicPayloadSizes)
+{
+    return reserveChunk(payloadSize, mepoo::ChunkLayout(), useDynamicPayloadSizes);
+}
+
+mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize,
+                                             const mepoo::ChunkLayout& chunkLayout,
+                                             bool useDynamicPayloadSizes)
 {
     if (!getMembers()->m_memoryMgr)
     {
@@ -130,18 +137,21 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
         errorHandler(Error::kPOSH__SENDERPORT_SAMPLE_SIZE_CHANGED_FOR_ACTIVE_PORT);
     }
 
-    // if it is no field and we have a last chunk which is only owned by us, then use this chunk again
+    // if it is no field and we have a last chunk which is only owned by us and has the same layout, then use this
+    // chunk again
+    auto lastChunkHeader = getMembers()->m_lastChunk.getChunkHeader();
     if (!getMembers()->m_receiverHandler.doesDeliverOnSubscribe() && getMembers()->m_lastChunk
         && getMembers()->m_lastChunk.hasNoOtherOwners()
-        && getMembers()->m_lastChunk.getChunkHeader()->m_info.m_usedSizeOfChunk
-               >= getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize))
+        && lastChunkHeader->m_payloadAlignment == chunkLayout.m_payloadAlignment
+        && lastChunkHeader->m_userHeaderSize == chunkLayout.m_userHeaderSize
+        && lastChunkHeader->m_info.m_usedSizeOfChunk >= lastChunkHeader->m_payloadOffset + payloadSize)
     {
         if (pushToAllocatedChunkContainer(getMembers()->m_lastChunk))
         {
-            getMembers()->m_lastChunk.getChunkHeader()->m_info.m_payloadSize = payloadSize;
-            getMembers()->m_lastChunk.getChunkHeader()->m_info.m_usedSizeOfChunk =
-                getMembers()->m_memoryMgr->sizeWithChunkHeaderStruct(payloadSize);
-            return getMembers()->m_lastChunk.getChunkHeader();
+            lastChunkHeader->m_info.m_payloadSize = payloadSize;
+            lastChunkHeader->m_info.m_usedSizeOfChunk = lastChunkHeader->m_payloadOffset + payloadSize;
+            setLatencyTracing(lastChunkHeader->m_info);
+            return lastChunkHeader;
         }
         else
         {
@@ -152,7 +162,7 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
     else
     {
         // get a new chunk
-        mepoo::SharedChunk l_chunk = getMembers()->m_memoryMgr->getChunk(payloadSize);
+        mepoo::SharedChunk l_chunk = getMembers()->m_memoryMgr->getChunk(payloadSize, chunkLayout);
 
         if (l_chunk)
         {
@@ -160,6 +170,7 @@ mepoo::ChunkHeader* SenderPort::reserveChunk(const uint32_t payloadSize, bool us
             if (pushToAllocatedChunkContainer(l_chunk))
             {
                 l_chunk.getChunkHeader()->m_info.m_payloadSize = payloadSize;
+                setLatencyTracing(l_chunk.getChunkHeader()->m_info);
                 return l_chunk.getChunkHeader();
             }
             else
@@ -194,6 +205,11 @@ void SenderPort::setThroughputDeliveryData(mepoo::ChunkInfo& chunkInfo, bool upd
     getMembers()->m_throughput.currentDeliveryTimestamp = mepoo::BaseClock::now();
     if (updateTimeInChunk)
     {
+        if (chunkInfo.m_isLatencyTraced)
+        {
+            getMembers()->m_allocateToSendLatency.record(getMembers()->m_throughput.currentDeliveryTimestamp
+                                                         - chunkInfo.m_txTimestamp);
+        }
         chunkInfo.m_txTimestamp = getMembers()->m_throughput.currentDeliveryTimestamp;
     }
 
@@ -201,6 +217,16 @@ void SenderPort::setThroughputDeliveryData(mepoo::ChunkInfo& chunkInfo, bool upd
     getMembers()->m_throughputExchange.store(getMembers()->m_throughput, MemberType_t::ThreadContext::Application);
 }
 
+void SenderPort::setLatencyTracing(mepoo::ChunkInfo& chunkInfo)
+{
+    // a recycled chunk still has the flag of its last delivery
+    chunkInfo.m_isLatencyTraced = getMembers()->m_isLatencyTracingEnabled.load(std::memory_order_relaxed);
+    if (chunkInfo.m_isLatencyTraced)
+    {
+        chunkInfo.m_txTimestamp = mepoo::BaseClock::now();
+    }
+}
+
 void SenderPort::deliverChunk(mepoo::ChunkHeader* const chunkHeader)
 {
     bool l_isOffered = getMembers()->m_activateRequested.load(std::memory_order_relaxed);
@@ -289,6 +315,7 @@ void SenderPort::activate()
     if (!getMembers()->m_activateRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_activateRequested.store(true, std::memory_order_relaxed);
+        notifyDiscovery();
 
         if (getMembers()->m_receiverHandler.doesDeliverOnSubscribe()
             && !getMembers()->m_receiverHandler.appContext().hasLastChunk())
@@ -305,6 +332,7 @@ void SenderPort::deactivate()
         this->getMembers()->m_activateRequested.store(false, std::memory_order_relaxed);
 
         getMembers()->m_activePayloadSize.store(0u, std::memory_order_relaxed);
+        notifyDiscovery();
     }
 }
 
@@ -335,6 +363,26 @@ SenderPort::MemberType_t::Throughput SenderPort::getThroughput() const
     return getMembers()->m_throughputReadCache;
 }
 
+void SenderPort::enableLatencyTracing()
+{
+    getMembers()->m_isLatencyTracingEnabled.store(true, std::memory_order_relaxed);
+}
+
+void SenderPort::disableLatencyTracing()
+{
+    getMembers()->m_isLatencyTracingEnabled.store(false, std::memory_order_relaxed);
+}
+
+bool SenderPort::isLatencyTracingEnabled() const
+{
+    return getMembers()->m_isLatencyTracingEnabled.load(std::memory_order_relaxed);
+}
+
+const LatencyHistogram& SenderPort::getAllocateToSendLatency() const
+{
+    return getMembers()->m_allocateToSendLatency;
+}
+
 bool SenderPort::hasValidService(const capro::CaproMessage& caproMessage)
 {
     if (caproMessage.m_serviceDescription == getMembers()->m_serviceDescription)
@@ -97,5 +97,10 @@ WaitSet::ConditionVector WaitSet::wait() noexcept
     return waitAndReturnFulfilledConditions<WaitPolicy::BLOCKING_WAIT>(cxx::nullopt);
 }
 
+void WaitSet::setWaitStrategy(const WaitStrategy& waitStrategy) noexcept
+{
+    m_conditionVariableWaiter.setWaitStrategy(waitStrategy);
+}
+
 } // namespace popo
 } // namespace iox
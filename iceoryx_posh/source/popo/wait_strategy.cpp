@@ -0,0 +1,43 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/wait_strategy.hpp"
+
+namespace iox
+{
+namespace popo
+{
+WaitStrategy::WaitStrategy(const uint64_t spinIterations, const uint64_t yieldIterations) noexcept
+    : m_spinIterations(spinIterations)
+    , m_yieldIterations(yieldIterations)
+{
+}
+
+uint64_t WaitStrategy::getSpinIterations() const noexcept
+{
+    return m_spinIterations;
+}
+
+uint64_t WaitStrategy::getYieldIterations() const noexcept
+{
+    return m_yieldIterations;
+}
+
+bool WaitStrategy::isBlockingOnly() const noexcept
+{
+    return m_spinIterations == 0U && m_yieldIterations == 0U;
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,55 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+namespace
+{
+// FNV-1a, the strings of a service description are short and hashed without an allocation
+constexpr std::size_t FNV_OFFSET_BASIS{14695981039346656037u};
+constexpr std::size_t FNV_PRIME{1099511628211u};
+
+std::size_t hashString(std::size_t hash, const capro::IdString& value) noexcept
+{
+    for (const char* character = value.c_str(); *character != '\0'; ++character)
+    {
+        hash = (hash ^ static_cast<unsigned char>(*character)) * FNV_PRIME;
+    }
+    // separator, otherwise "ab" + "c" and "a" + "bc" would result in the same hash
+    return (hash ^ 0xFFu) * FNV_PRIME;
+}
+
+std::size_t hashId(const std::size_t hash, const uint16_t value) noexcept
+{
+    return (((hash ^ (value & 0xFFu)) * FNV_PRIME) ^ (value >> 8u)) * FNV_PRIME;
+}
+} // namespace
+
+std::size_t ServiceDescriptionHash::operator()(const capro::ServiceDescription& service) const noexcept
+{
+    std::size_t hash = FNV_OFFSET_BASIS;
+    hash = hashString(hash, service.getServiceIDString());
+    hash = hashString(hash, service.getInstanceIDString());
+    hash = hashString(hash, service.getEventIDString());
+    hash = hashId(hash, service.getServiceID());
+    hash = hashId(hash, service.getInstanceID());
+    return hashId(hash, service.getEventID());
+}
+
+} // namespace roudi
+} // namespace iox
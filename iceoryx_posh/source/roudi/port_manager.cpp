@@ -82,6 +82,9 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    // everything is handled, therefore the pending notifications are obsolete
+    m_portPool->discoveryTrigger().takeNotifiedPortKinds();
+
     handleSenderPorts();
 
     handleReceiverPorts();
@@ -93,6 +96,42 @@ void PortManager::doDiscovery() noexcept
     handleRunnables();
 }
 
+void PortManager::doDiscoveryOfNotifiedPorts() noexcept
+{
+    using PortKind = popo::DiscoveryTrigger::PortKind;
+    const auto portKinds = m_portPool->discoveryTrigger().takeNotifiedPortKinds();
+
+    if (popo::DiscoveryTrigger::contains(portKinds, PortKind::SENDER))
+    {
+        handleSenderPorts();
+    }
+
+    if (popo::DiscoveryTrigger::contains(portKinds, PortKind::RECEIVER))
+    {
+        handleReceiverPorts();
+    }
+
+    if (popo::DiscoveryTrigger::contains(portKinds, PortKind::APPLICATION))
+    {
+        handleApplications();
+    }
+
+    if (popo::DiscoveryTrigger::contains(portKinds, PortKind::INTERFACE))
+    {
+        handleInterfaces();
+    }
+
+    if (popo::DiscoveryTrigger::contains(portKinds, PortKind::RUNNABLE))
+    {
+        handleRunnables();
+    }
+}
+
+bool PortManager::waitForDiscoveryTrigger(const units::Duration timeout) noexcept
+{
+    return m_portPool->discoveryTrigger().timedWait(timeout);
+}
+
 /// @deprecated #25
 void PortManager::handleSenderPorts()
 {
@@ -267,6 +306,7 @@ void PortManager::handleInterfaces() noexcept
             LogDebug() << "Destroyed InterfacePortData";
         }
     }
+    updateLookupInServiceRegistryTable();
 
     if (interfacePortsForInitialForwarding.size() > 0)
     {
@@ -388,11 +428,9 @@ void PortManager::handleRunnables() noexcept
 bool PortManager::sendToAllMatchingSenderPorts(const capro::CaproMessage& message, ReceiverPortType& receiverSource)
 {
     bool senderFound = false;
-    for (auto senderPortData : m_portPool->senderPortDataList())
-    {
-        SenderPortType senderPort(senderPortData);
-        if (receiverSource.getCaProServiceDescription() == senderPort.getCaProServiceDescription())
-        {
+    m_senderPortIndex.forEachMatchingPort(
+        receiverSource.getCaProServiceDescription(), [&](SenderPortType::MemberType_t* const senderPortData) {
+            SenderPortType senderPort(senderPortData);
             auto senderResponse = senderPort.dispatchCaProMessage(message);
             if (senderResponse.has_value())
             {
@@ -406,19 +444,16 @@ bool PortManager::sendToAllMatchingSenderPorts(const capro::CaproMessage& messag
                 m_portIntrospection.reportMessage(senderResponse.value());
             }
             senderFound = true;
-        }
-    }
+        });
     return senderFound;
 }
 
 /// @deprecated #25
 void PortManager::sendToAllMatchingReceiverPorts(const capro::CaproMessage& message, SenderPortType& senderSource)
 {
-    for (auto receiverPortData : m_portPool->receiverPortDataList())
-    {
-        ReceiverPortType receiverPort(receiverPortData);
-        if (receiverPort.getCaProServiceDescription() == senderSource.getCaProServiceDescription())
-        {
+    m_receiverPortIndex.forEachMatchingPort(
+        senderSource.getCaProServiceDescription(), [&](ReceiverPortType::MemberType_t* const receiverPortData) {
+            ReceiverPortType receiverPort(receiverPortData);
             auto receiverResponse = receiverPort.dispatchCaProMessage(message);
 
             // if the receivers react on the change, process it immediately on sender side
@@ -443,19 +478,17 @@ void PortManager::sendToAllMatchingReceiverPorts(const capro::CaproMessage& mess
                     m_portIntrospection.reportMessage(senderResponse.value());
                 }
             }
-        }
-    }
+        });
 }
 
 bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& message,
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType publisherPort(publisherPortData);
-        if (subscriberSource.getCaProServiceDescription() == publisherPort.getCaProServiceDescription())
-        {
+    m_publisherPortIndex.forEachMatchingPort(
+        subscriberSource.getCaProServiceDescription(),
+        [&](PublisherPortRouDiType::MemberType_t* const publisherPortData) {
+            PublisherPortRouDiType publisherPort(publisherPortData);
             auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
             if (publisherResponse.has_value())
             {
@@ -470,19 +503,16 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                 m_portIntrospection.reportMessage(publisherResponse.value());
             }
             publisherFound = true;
-        }
-    }
+        });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
-        SubscriberPortType subscriberPort(subscriberPortData);
-        if (subscriberPort.getCaProServiceDescription() == publisherSource.getCaProServiceDescription())
-        {
+    m_subscriberPortIndex.forEachMatchingPort(
+        publisherSource.getCaProServiceDescription(), [&](SubscriberPortType::MemberType_t* const subscriberPortData) {
+            SubscriberPortType subscriberPort(subscriberPortData);
             auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
             // if the subscribers react on the change, process it immediately on publisher side
@@ -509,8 +539,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                     m_portIntrospection.reportMessage(publisherResponse.value());
                 }
             }
-        }
-    }
+        });
 }
 
 void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept
@@ -556,6 +585,7 @@ void PortManager::deletePortsOfProcess(const ProcessName_t& processName) noexcep
             LogDebug() << "Deleted Interface of application " << processName;
         }
     }
+    updateLookupInServiceRegistryTable();
 
     for (auto port : m_portPool->getApplicationPortDataList())
     {
@@ -595,6 +625,7 @@ void PortManager::destroySenderPort(SenderPortType::MemberType_t* const senderPo
     m_portIntrospection.removeSender(senderPort.getProcessName(), serviceDescription);
 
     // delete sender impl from list after StopOffer was processed
+    m_senderPortIndex.remove(senderPortData);
     m_portPool->removeSenderPort(senderPortData);
     LogDebug() << "Destroyed SenderPortImpl";
 }
@@ -616,6 +647,7 @@ void PortManager::destroyReceiverPort(ReceiverPortType::MemberType_t* const rece
     m_portIntrospection.removeReceiver(receiverPort.getProcessName(), serviceDescription);
 
     // delete receiver impl from list after unsubscribe was processed
+    m_receiverPortIndex.remove(receiverPortData);
     m_portPool->removeReceiverPort(receiverPortData);
     LogDebug() << "Destroyed ReceiverPortImpl";
 }
@@ -644,6 +676,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     // m_portIntrospection.removePublisher(publisherPort.getProcessName(), serviceDescription);
 
     // delete publisher port from list after STOP_OFFER was processed
+    m_publisherPortIndex.remove(publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 
     LogDebug() << "Destroyed publisher port";
@@ -670,12 +703,29 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     // m_portIntrospection.removeSubscriber(subscriberPort.getProcessName(), serviceDescription);
 
     // delete subscriber port from list after UNSUB was processed
+    m_subscriberPortIndex.remove(subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 
     LogDebug() << "Destroyed subscriber port";
 }
 
 runtime::MqMessage PortManager::findService(const capro::ServiceDescription& service) noexcept
+{
+    ServiceRegistry::InstanceSet_t instances;
+    findService(service, instances);
+
+    // add all found instances to instanceString
+    runtime::MqMessage instanceMessage;
+    for (auto& instance : instances)
+    {
+        instanceMessage << instance;
+    }
+
+    return instanceMessage;
+}
+
+void PortManager::findService(const capro::ServiceDescription& service,
+                              ServiceRegistry::InstanceSet_t& instances) noexcept
 {
     // send find to all interfaces
     capro::CaproMessage caproMessage(capro::CaproMessageType::FIND, service);
@@ -686,17 +736,7 @@ runtime::MqMessage PortManager::findService(const capro::ServiceDescription& ser
         interfacePort.dispatchCaProMessage(caproMessage);
     }
 
-    // add all found instances to instanceString
-    runtime::MqMessage instanceMessage;
-
-    ServiceRegistry::InstanceSet_t instances;
     m_serviceRegistry.find(instances, service.getServiceIDString(), service.getInstanceIDString());
-    for (auto& instance : instances)
-    {
-        instanceMessage << instance;
-    }
-
-    return instanceMessage;
 }
 
 const std::atomic<uint64_t>* PortManager::serviceRegistryChangeCounter() noexcept
@@ -713,24 +753,23 @@ PortManager::acquireSenderPortData(const capro::ServiceDescription& service,
                                    const PortConfigInfo& portConfigInfo)
 {
     // check if already in list, we currently do not support multi publisher for one CaPro ID
-    for (auto senderPortData : m_portPool->senderPortDataList())
+    SenderPortType::MemberType_t* usedSenderPortData{nullptr};
+    m_senderPortIndex.forEachMatchingPort(service, [&](SenderPortType::MemberType_t* const senderPortData) {
+        if (usedSenderPortData == nullptr)
+        {
+            usedSenderPortData = senderPortData;
+        }
+    });
+    if (usedSenderPortData != nullptr)
     {
-        SenderPortType senderPort(senderPortData);
-        if (service == senderPort.getCaProServiceDescription())
+        SenderPortType senderPort(usedSenderPortData);
+        LogWarn() << "Process '" << processName << "' tried to register an unique SenderPort which is already used by '"
+                  << usedSenderPortData->m_processName << "' with service '"
+                  << service.operator cxx::Serialization().toString() << "'.";
+        if (senderPort.isUnique())
         {
-            LogWarn() << "Process '" << processName
-                      << "' tried to register an unique SenderPort which is already used by '"
-                      << senderPortData->m_processName << "' with service '"
-                      << service.operator cxx::Serialization().toString() << "'.";
-            if (senderPort.isUnique())
-            {
-                errorHandler(Error::kPOSH__PORT_MANAGER_SENDERPORT_NOT_UNIQUE, nullptr, ErrorLevel::MODERATE);
-                return cxx::error<PortPoolError>(PortPoolError::UNIQUE_SENDER_PORT_ALREADY_EXISTS);
-            }
-            else
-            {
-                break;
-            }
+            errorHandler(Error::kPOSH__PORT_MANAGER_SENDERPORT_NOT_UNIQUE, nullptr, ErrorLevel::MODERATE);
+            return cxx::error<PortPoolError>(PortPoolError::UNIQUE_SENDER_PORT_ALREADY_EXISTS);
         }
     }
     // we can create a new port
@@ -738,6 +777,7 @@ PortManager::acquireSenderPortData(const capro::ServiceDescription& service,
     auto result = m_portPool->addSenderPort(service, payloadMemoryManager, processName, portConfigInfo.memoryInfo);
     if (!result.has_error())
     {
+        m_senderPortIndex.add(result.get_value());
         m_portIntrospection.addSender(result.get_value(), processName, service, runnable);
     }
 
@@ -753,6 +793,7 @@ ReceiverPortType::MemberType_t* PortManager::acquireReceiverPortData(const capro
     auto result = m_portPool->addReceiverPort(service, processName, portConfigInfo.memoryInfo);
     if (!result.has_error())
     {
+        m_receiverPortIndex.add(result.get_value());
         m_portIntrospection.addReceiver(result.get_value(), processName, service, runnable);
         return result.get_value();
     }
@@ -787,6 +828,7 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
         service, historyCapacity, payloadMemoryManager, processName, portConfigInfo.memoryInfo);
     if (!maybePublisherPortData.has_error())
     {
+        m_publisherPortIndex.add(maybePublisherPortData.get_value());
         /// @todo #25 Fix introspection
         // m_portIntrospection.addSender(result.get_value(), processName, service, runnable);
     }
@@ -805,6 +847,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         m_portPool->addSubscriberPort(service, historyRequest, processName, portConfigInfo.memoryInfo);
     if (!maybeSubscriberPortData.has_error())
     {
+        m_subscriberPortIndex.add(maybeSubscriberPortData.get_value());
         /// @todo #25 Fix introspection
         // m_portIntrospection.addReceiver(result.get_value(), processName, service, runnable);
     }
@@ -821,6 +864,7 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
     auto result = m_portPool->addInterfacePort(processName, interface);
     if (!result.has_error())
     {
+        updateLookupInServiceRegistryTable();
         return result.get_value();
     }
     else
@@ -846,6 +890,10 @@ popo::ApplicationPortData* PortManager::acquireApplicationPortData(const Process
 void PortManager::addEntryToServiceRegistry(const capro::IdString& service, const capro::IdString& instance) noexcept
 {
     m_serviceRegistry.add(service, instance);
+    if (!m_portPool->serviceRegistryTable().add(service, instance))
+    {
+        LogWarn() << "The service registry table is full, the applications look services up with a request to RouDi";
+    }
     m_portPool->serviceRegistryChangeCounter()->fetch_add(1, std::memory_order_relaxed);
 }
 
@@ -853,9 +901,21 @@ void PortManager::removeEntryFromServiceRegistry(const capro::IdString& service,
                                                  const capro::IdString& instance) noexcept
 {
     m_serviceRegistry.remove(service, instance);
+    m_portPool->serviceRegistryTable().remove(service, instance);
     m_portPool->serviceRegistryChangeCounter()->fetch_add(1, std::memory_order_relaxed);
 }
 
+void PortManager::updateLookupInServiceRegistryTable() noexcept
+{
+    // a FIND is forwarded to the interfaces, this is only done when RouDi handles the look up
+    m_portPool->serviceRegistryTable().setLookupByRouDiRequired(!m_portPool->getInterfacePortDataList().empty());
+}
+
+runtime::ServiceRegistryTable* PortManager::serviceRegistryTable() noexcept
+{
+    return &m_portPool->serviceRegistryTable();
+}
+
 /// @todo return a cxx::expected
 runtime::RunnableData* PortManager::acquireRunnableData(const ProcessName_t& process,
                                                         const RunnableName_t& runnable) noexcept
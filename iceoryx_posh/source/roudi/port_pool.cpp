@@ -47,6 +47,9 @@ PortPool::addInterfacePort(const std::string& applicationName, const capro::Inte
     {
         auto interfacePortData = m_portPoolData->m_interfacePortMembers.insert(
             iox::cxx::string<100>(iox::cxx::TruncateToCapacity, applicationName), interface);
+        attachDiscoveryTrigger(interfacePortData, popo::DiscoveryTrigger::PortKind::INTERFACE);
+        // a new interface needs the initial offer forwarding
+        m_portPoolData->m_discoveryTrigger.notify(popo::DiscoveryTrigger::PortKind::INTERFACE);
         return cxx::success<popo::InterfacePortData*>(interfacePortData);
     }
     else
@@ -63,6 +66,7 @@ PortPool::addApplicationPort(const std::string& applicationName) noexcept
     {
         auto applicationPortData = m_portPoolData->m_applicationPortMembers.insert(
             iox::cxx::string<100>(iox::cxx::TruncateToCapacity, applicationName));
+        attachDiscoveryTrigger(applicationPortData, popo::DiscoveryTrigger::PortKind::APPLICATION);
         return cxx::success<popo::ApplicationPortData*>(applicationPortData);
     }
     else
@@ -78,6 +82,7 @@ cxx::expected<runtime::RunnableData*, PortPoolError> PortPool::addRunnableData(
     if (m_portPoolData->m_runnableMembers.hasFreeSpace())
     {
         auto runnableData = m_portPoolData->m_runnableMembers.insert(process, runnable, runnableDeviceIdentifier);
+        runnableData->m_discoveryTrigger = &m_portPoolData->m_discoveryTrigger;
         return cxx::success<runtime::RunnableData*>(runnableData);
     }
     else
@@ -116,11 +121,28 @@ void PortPool::removeRunnableData(runtime::RunnableData* const runnableData) noe
     m_portPoolData->m_runnableMembers.erase(runnableData);
 }
 
+popo::DiscoveryTrigger& PortPool::discoveryTrigger() noexcept
+{
+    return m_portPoolData->m_discoveryTrigger;
+}
+
+void PortPool::attachDiscoveryTrigger(popo::BasePortData* const portData,
+                                      const popo::DiscoveryTrigger::PortKind portKind) noexcept
+{
+    portData->m_discoveryTrigger = &m_portPoolData->m_discoveryTrigger;
+    portData->m_discoveryPortKind = portKind;
+}
+
 std::atomic<uint64_t>* PortPool::serviceRegistryChangeCounter() noexcept
 {
     return &m_portPoolData->m_serviceRegistryChangeCounter;
 }
 
+runtime::ServiceRegistryTable& PortPool::serviceRegistryTable() noexcept
+{
+    return m_portPoolData->m_serviceRegistryTable;
+}
+
 /// @deprecated #25
 cxx::vector<SenderPortType::MemberType_t*, MAX_PUBLISHERS> PortPool::senderPortDataList() noexcept
 {
@@ -144,6 +166,7 @@ PortPool::addSenderPort(const capro::ServiceDescription& serviceDescription,
     {
         auto senderPortData =
             m_portPoolData->m_senderPortMembers.insert(serviceDescription, memoryManager, applicationName, memoryInfo);
+        attachDiscoveryTrigger(senderPortData, popo::DiscoveryTrigger::PortKind::SENDER);
         return cxx::success<SenderPortType::MemberType_t*>(senderPortData);
     }
     else
@@ -163,6 +186,7 @@ PortPool::addReceiverPort(const capro::ServiceDescription& serviceDescription,
     {
         auto receiverPortData =
             m_portPoolData->m_receiverPortMembers.insert(serviceDescription, applicationName, memoryInfo);
+        attachDiscoveryTrigger(receiverPortData, popo::DiscoveryTrigger::PortKind::RECEIVER);
         return cxx::success<ReceiverPortType::MemberType_t*>(receiverPortData);
     }
     else
@@ -22,6 +22,10 @@
 #include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/fixed_string/string100.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <string>
+
 namespace iox
 {
 namespace roudi
@@ -31,9 +35,11 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              const config::MonitoringMode monitoringMode,
              const bool killProcessesInDestructor,
              const MQThreadStart mqThreadStart,
-             const version::CompatibilityCheckLevel compatibilityCheckLevel)
+             const version::CompatibilityCheckLevel compatibilityCheckLevel,
+             const uint32_t numberOfMqWorkerThreads)
     : m_killProcessesInDestructor(killProcessesInDestructor)
     , m_runThreads(true)
+    , m_numberOfMqWorkerThreads(std::max(numberOfMqWorkerThreads, 1U))
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
     , m_prcMgr(*m_roudiMemoryInterface, portManager, compatibilityCheckLevel)
@@ -69,8 +75,18 @@ RouDi::~RouDi()
 
 void RouDi::startMQThread()
 {
-    m_processMQThread = std::thread(&RouDi::mqThread, this);
-    pthread_setname_np(m_processMQThread.native_handle(), "MQ-processing");
+    m_roudiMqInterface.reset(new runtime::MqInterfaceCreator(MQ_ROUDI_NAME));
+
+    // the logger is intentionally not used, to ensure that this message is always printed
+    std::cout << "RouDi is ready for clients" << std::endl;
+
+    for (uint32_t i = 0U; i < m_numberOfMqWorkerThreads; ++i)
+    {
+        m_processMQThreads.emplace_back(&RouDi::mqThread, this);
+        // the name of a thread is limited to 16 characters including the terminating null character
+        std::string threadName = "MQ-processing-" + std::to_string(i);
+        pthread_setname_np(m_processMQThreads.back().native_handle(), threadName.substr(0U, 15U).c_str());
+    }
 }
 
 void RouDi::shutdown()
@@ -91,12 +107,17 @@ void RouDi::shutdown()
         m_processManagementThread.join();
         LogDebug() << "...'ProcessMgmt' thread joined.";
     }
-    if (m_processMQThread.joinable())
+    LogDebug() << "Joining 'MQ-processing' threads...";
+    for (auto& mqThread : m_processMQThreads)
     {
-        LogDebug() << "Joining 'MQ-processing' thread...";
-        m_processMQThread.join();
-        LogDebug() << "...'MQ-processing' thread joined.";
+        if (mqThread.joinable())
+        {
+            mqThread.join();
+        }
     }
+    m_processMQThreads.clear();
+    m_roudiMqInterface.reset();
+    LogDebug() << "...'MQ-processing' threads joined.";
 }
 
 void RouDi::cyclicUpdateHook()
@@ -116,21 +137,22 @@ void RouDi::processThread()
 
 void RouDi::mqThread()
 {
-    runtime::MqInterfaceCreator roudiMqInterface{MQ_ROUDI_NAME};
-
-    // the logger is intentionally not used, to ensure that this message is always printed
-    std::cout << "RouDi is ready for clients" << std::endl;
-
     while (m_runThreads)
     {
         // read RouDi message queue
         runtime::MqMessage message;
+        runtime::MqBinaryMessage binaryMessage;
         /// @todo do we really need timedReceive? an alternative solution would be to close the message queue,
         /// which also results in a return from mq_receive, and check the relevant errno and shutdown RouDi
-        if (!roudiMqInterface.timedReceive(m_messageQueueTimeout, message))
+        auto protocol = m_roudiMqInterface->timedReceiveAnyProtocol(m_messageQueueTimeout, message, binaryMessage);
+        if (!protocol.has_value())
         {
             // TODO: errorHandling
         }
+        else if (protocol.value() == runtime::MqProtocol::BINARY)
+        {
+            processBinaryMessage(binaryMessage);
+        }
         else
         {
             auto cmd = runtime::stringToMqMessageType(message.getElementAtIndex(0).c_str());
@@ -163,6 +185,11 @@ void RouDi::processMessage(const runtime::MqMessage& message,
         m_prcMgr.sendServiceRegistryChangeCounterToProcess(ProcessName_t(cxx::TruncateToCapacity, processName));
         break;
     }
+    case runtime::MqMessageType::SERVICE_REGISTRY_TABLE:
+    {
+        m_prcMgr.sendServiceRegistryTableToProcess(ProcessName_t(cxx::TruncateToCapacity, processName));
+        break;
+    }
     case runtime::MqMessageType::REG:
     {
         if (message.getNumberOfElements() != 6)
@@ -357,23 +384,168 @@ void RouDi::processMessage(const runtime::MqMessage& message,
     }
 }
 
+void RouDi::processBinaryMessage(runtime::MqBinaryMessage& message)
+{
+    int64_t type{0};
+    ProcessName_t processName;
+    if (!message.readSigned(type) || !message.readString(processName))
+    {
+        LogError() << "Received binary message without type and process name!";
+        return;
+    }
+
+    const auto cmd = static_cast<runtime::MqMessageType>(type);
+    switch (cmd)
+    {
+    case runtime::MqMessageType::REG:
+    {
+        int64_t pid{0};
+        uint64_t userId{0u};
+        int64_t transmissionTimestamp{0};
+        cxx::CString100 versionInfo;
+        if (!(message.readSigned(pid) && message.readUnsigned(userId) && message.readSigned(transmissionTimestamp)
+              && message.readString(versionInfo)))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::REG\" from \"" << processName << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            registerProcess(processName.c_str(),
+                            static_cast<int>(pid),
+                            {static_cast<uid_t>(userId)},
+                            transmissionTimestamp,
+                            getUniqueSessionIdForProcess(),
+                            version::VersionInfo(cxx::Serialization(versionInfo.c_str())),
+                            runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+
+    /// @deprecated #25
+    case runtime::MqMessageType::CREATE_SENDER:
+    {
+        capro::ServiceDescription service;
+        RunnableName_t runnableName;
+        runtime::PortConfigInfo portConfigInfo;
+        if (!(message.readServiceDescription(service) && message.readString(runnableName)
+              && message.readPortConfigInfo(portConfigInfo)))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::CREATE_SENDER\" from \"" << processName
+                       << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            m_prcMgr.addSenderForProcess(
+                processName, service, runnableName, portConfigInfo, runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+
+    /// @deprecated #25
+    case runtime::MqMessageType::CREATE_RECEIVER:
+    {
+        capro::ServiceDescription service;
+        RunnableName_t runnableName;
+        runtime::PortConfigInfo portConfigInfo;
+        if (!(message.readServiceDescription(service) && message.readString(runnableName)
+              && message.readPortConfigInfo(portConfigInfo)))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::CREATE_RECEIVER\" from \"" << processName
+                       << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            m_prcMgr.addReceiverForProcess(
+                processName, service, runnableName, portConfigInfo, runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+    case runtime::MqMessageType::CREATE_PUBLISHER:
+    {
+        capro::ServiceDescription service;
+        uint64_t historyCapacity{0u};
+        RunnableName_t runnableName;
+        runtime::PortConfigInfo portConfigInfo;
+        if (!(message.readServiceDescription(service) && message.readUnsigned(historyCapacity)
+              && message.readString(runnableName) && message.readPortConfigInfo(portConfigInfo)))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::CREATE_PUBLISHER\" from \"" << processName
+                       << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            m_prcMgr.addPublisherForProcess(
+                processName, service, historyCapacity, runnableName, portConfigInfo, runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+    case runtime::MqMessageType::CREATE_SUBSCRIBER:
+    {
+        capro::ServiceDescription service;
+        uint64_t historyRequest{0u};
+        RunnableName_t runnableName;
+        runtime::PortConfigInfo portConfigInfo;
+        if (!(message.readServiceDescription(service) && message.readUnsigned(historyRequest)
+              && message.readString(runnableName) && message.readPortConfigInfo(portConfigInfo)))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::CREATE_SUBSCRIBER\" from \"" << processName
+                       << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            m_prcMgr.addSubscriberForProcess(
+                processName, service, historyRequest, runnableName, portConfigInfo, runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+    case runtime::MqMessageType::FIND_SERVICE:
+    {
+        capro::ServiceDescription service;
+        if (!message.readServiceDescription(service))
+        {
+            LogError() << "Wrong parameter for \"MqMessageType::FIND_SERVICE\" from \"" << processName
+                       << "\"received!";
+            m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        }
+        else
+        {
+            m_prcMgr.findServiceForProcess(processName, service, runtime::MqProtocol::BINARY);
+        }
+        break;
+    }
+    default:
+    {
+        LogError() << "Unsupported binary MQ Command [" << type << "]";
+
+        m_prcMgr.sendMessageNotSupportedToRuntime(processName, runtime::MqProtocol::BINARY);
+        break;
+    }
+    }
+}
+
 bool RouDi::registerProcess(const std::string& name,
                             int pid,
                             posix::PosixUser user,
                             int64_t transmissionTimestamp,
                             const uint64_t sessionId,
-                            const version::VersionInfo& versionInfo)
+                            const version::VersionInfo& versionInfo,
+                            const runtime::MqProtocol protocol)
 {
     bool monitorProcess = (m_monitoringMode == config::MonitoringMode::ON);
     auto truncatedName = ProcessName_t(cxx::TruncateToCapacity, name);
     return m_prcMgr.registerProcess(
-        truncatedName, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo);
+        truncatedName, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo, protocol);
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess()
 {
-    static uint64_t sessionId = 0;
-    return ++sessionId;
+    static std::atomic<uint64_t> sessionId{0U};
+    return sessionId.fetch_add(1U, std::memory_order_relaxed) + 1U;
 }
 
 void RouDi::mqMessageErrorHandler()
@@ -97,6 +97,7 @@ iox::cxx::expected<iox::RouDiConfig_t, iox::roudi::RouDiConfigFileParseError> To
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
         iox::mepoo::MePooConfig mempoolConfig;
+        mempoolConfig.setSpillOverMemPools(segment->get_as<uint32_t>("spillover").value_or(0u));
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -58,6 +58,11 @@ void RouDiProcess::sendToMQ(const runtime::MqMessage& data) noexcept
     m_mq.send(data);
 }
 
+void RouDiProcess::sendToMQ(const runtime::MqBinaryMessage& data) noexcept
+{
+    m_mq.send(data);
+}
+
 uint64_t RouDiProcess::getSessionId() noexcept
 {
     return m_sessionId.load(std::memory_order_relaxed);
@@ -73,6 +78,39 @@ mepoo::TimePointNs RouDiProcess::getTimestamp() noexcept
     return m_timestamp;
 }
 
+void RouDiProcess::setApplicationPortData(popo::ApplicationPortData* const applicationPortData) noexcept
+{
+    m_applicationPortData = applicationPortData;
+    if (m_applicationPortData != nullptr)
+    {
+        m_lastKeepAliveCounter = popo::ApplicationPort(m_applicationPortData).getKeepAliveCounter();
+    }
+}
+
+void RouDiProcess::updateTimestampFromKeepAliveCounter(const mepoo::TimePointNs timestamp) noexcept
+{
+    if (m_applicationPortData == nullptr)
+    {
+        return;
+    }
+
+    popo::ApplicationPort applicationPort(m_applicationPortData);
+    // the application port is removed when the application destroyed it, then the keep alive counter is not valid;
+    // the runtime falls back to KEEPALIVE messages which refresh the timestamp via updateLivelinessOfProcess
+    if (applicationPort.toBeDestroyed() || applicationPort.getProcessName() != getName())
+    {
+        m_applicationPortData = nullptr;
+        return;
+    }
+
+    const auto keepAliveCounter = applicationPort.getKeepAliveCounter();
+    if (keepAliveCounter != m_lastKeepAliveCounter)
+    {
+        m_lastKeepAliveCounter = keepAliveCounter;
+        m_timestamp = timestamp;
+    }
+}
+
 mepoo::MemoryManager* RouDiProcess::getPayloadMemoryManager() const noexcept
 {
     return m_payloadMemoryManager;
@@ -88,6 +126,16 @@ bool RouDiProcess::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+void RouDiProcess::markAsRemoved() noexcept
+{
+    m_isRemoved.store(true, std::memory_order_relaxed);
+}
+
+bool RouDiProcess::isRemoved() const noexcept
+{
+    return m_isRemoved.load(std::memory_order_relaxed);
+}
+
 //--------------------------------------------------------------------------------------------------
 
 ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
@@ -136,9 +184,9 @@ void ProcessManager::killAllProcesses() noexcept
 
     for (; itEnd != it; ++it)
     {
-        if (-1 == kill(static_cast<pid_t>(it->getPid()), SIGTERM))
+        if (-1 == kill(static_cast<pid_t>((*it)->getPid()), SIGTERM))
         {
-            LogWarn() << "Process " << it->getPid() << " could not be killed";
+            LogWarn() << "Process " << (*it)->getPid() << " could not be killed";
         }
     }
 }
@@ -149,7 +197,8 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
                                      bool isMonitored,
                                      int64_t transmissionTimestamp,
                                      const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+                                     const version::VersionInfo& versionInfo,
+                                     const runtime::MqProtocol protocol) noexcept
 {
     bool wasPreviouslyMonitored = false; // must be in outer scope but is only initialized before use
     bool processExists = false;
@@ -181,7 +230,8 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
                           transmissionTimestamp,
                           segmentInfo.m_segmentID,
                           sessionId,
-                          versionInfo);
+                          versionInfo,
+                          protocol);
     }
 
     // process is already in list (i.e. registered)
@@ -217,7 +267,8 @@ bool ProcessManager::registerProcess(const ProcessName_t& name,
                           transmissionTimestamp,
                           segmentInfo.m_segmentID,
                           sessionId,
-                          versionInfo); // call will acquire lock
+                          versionInfo,
+                          protocol); // call will acquire lock
     }
 
     return false;
@@ -230,7 +281,8 @@ bool ProcessManager::addProcess(const ProcessName_t& name,
                                 int64_t transmissionTimestamp,
                                 const uint64_t payloadSegmentId,
                                 const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+                                const version::VersionInfo& versionInfo,
+                                const runtime::MqProtocol protocol) noexcept
 {
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
@@ -241,30 +293,58 @@ bool ProcessManager::addProcess(const ProcessName_t& name,
             << " App: " << versionInfo.operator iox::cxx::Serialization().toString();
         return false;
     }
-    std::lock_guard<std::mutex> g(m_mutex);
-    // overflow check
-    if (m_processList.size() >= MAX_PROCESS_NUMBER)
-    {
-        LogError() << "Could not register process '" << name << "' - too many processes";
-        return false;
-    }
 
-    m_processList.emplace_back(name, pid, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId);
+    // the message queue of the process is opened without the lock, this way the registrations of several processes
+    // do not wait for each other
+    auto process =
+        std::make_shared<RouDiProcess>(name, pid, payloadMemoryManager, isMonitored, payloadSegmentId, sessionId);
 
-    // send REG_ACK and BaseAddrString
-    runtime::MqMessage sendBuffer;
+    {
+        std::lock_guard<std::mutex> g(m_mutex);
+        // overflow check
+        if (m_processList.size() >= MAX_PROCESS_NUMBER)
+        {
+            LogError() << "Could not register process '" << name << "' - too many processes";
+            return false;
+        }
 
-    auto offset = RelativePointer::getOffset(m_mgmtSegmentId, m_segmentManager);
-    sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::REG_ACK)
-               << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
-               << m_mgmtSegmentId;
+        // the existence check of registerProcess was done without the lock, another REG with the same name might have
+        // been processed in the meantime
+        if (getProcessFromList(name))
+        {
+            LogWarn() << "Received REG from " << name
+                      << ", but another application with this name was registered concurrently";
+            return false;
+        }
 
-    m_processList.back().sendToMQ(sendBuffer);
+        // set current timestamp again (already done in RouDiProcess's constructor
+        process->setTimestamp(mepoo::BaseClock::now());
+        m_processList.push_back(process);
 
-    // set current timestamp again (already done in RouDiProcess's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock::now());
+        m_processIntrospection->addProcess(pid, ProcessName_t(cxx::TruncateToCapacity, name.c_str()));
+    }
 
-    m_processIntrospection->addProcess(pid, ProcessName_t(cxx::TruncateToCapacity, name.c_str()));
+    // send REG_ACK and BaseAddrString; the process is already in the list when it receives the answer and sends its
+    // next request
+    auto offset = RelativePointer::getOffset(m_mgmtSegmentId, m_segmentManager);
+    if (protocol == runtime::MqProtocol::BINARY)
+    {
+        runtime::MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(runtime::MqMessageType::REG_ACK))
+            .addUnsigned(m_roudiMemoryInterface.mgmtMemoryProvider()->size())
+            .addUnsigned(offset)
+            .addSigned(transmissionTimestamp)
+            .addUnsigned(m_mgmtSegmentId);
+        process->sendToMQ(sendBuffer);
+    }
+    else
+    {
+        runtime::MqMessage sendBuffer;
+        sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::REG_ACK)
+                   << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
+                   << m_mgmtSegmentId;
+        process->sendToMQ(sendBuffer);
+    }
 
     LogDebug() << "Registered new application " << name;
     return true;
@@ -278,14 +358,9 @@ bool ProcessManager::removeProcess(const ProcessName_t& name) noexcept
     auto it = m_processList.begin();
     while (it != m_processList.end())
     {
-        if (it->getName() == name)
+        if ((*it)->getName() == name)
         {
-            m_portManager.deletePortsOfProcess(name);
-
-            m_processIntrospection->removeProcess(it->getPid());
-
-            // delete application
-            it = m_processList.erase(it);
+            eraseProcess(it);
 
             LogDebug() << "New Registration - removed existing application " << name;
             return true; // we can assume there are no other processes with this name
@@ -295,12 +370,29 @@ bool ProcessManager::removeProcess(const ProcessName_t& name) noexcept
     return false;
 }
 
+ProcessManager::ProcessList_t::iterator ProcessManager::eraseProcess(ProcessList_t::iterator processIterator) noexcept
+{
+    auto& process = *processIterator;
+    {
+        // a request of the process which already looked it up acquires its port either before the ports are deleted
+        // or sees the removal afterwards
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        process->markAsRemoved();
+        m_portManager.deletePortsOfProcess(process->getName());
+    }
+
+    m_processIntrospection->removeProcess(process->getPid());
+
+    // delete application
+    return m_processList.erase(processIterator);
+}
+
 void ProcessManager::updateLivelinessOfProcess(const ProcessName_t& name) noexcept
 {
     std::lock_guard<std::mutex> g(m_mutex);
 
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = getProcessFromList(name);
+    if (process)
     {
         // reset timestamp
         process->setTimestamp(mepoo::BaseClock::now());
@@ -311,15 +403,46 @@ void ProcessManager::updateLivelinessOfProcess(const ProcessName_t& name) noexce
     }
 }
 
-void ProcessManager::findServiceForProcess(const ProcessName_t& name, const capro::ServiceDescription& service) noexcept
+void ProcessManager::findServiceForProcess(const ProcessName_t& name,
+                                           const capro::ServiceDescription& service,
+                                           const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
-        runtime::MqMessage instanceString({m_portManager.findService(service)});
-        process->sendToMQ(instanceString);
+        if (protocol == runtime::MqProtocol::BINARY)
+        {
+            // the total number of instances is sent first, this way the application can detect when not all
+            // instances fit into the response
+            ServiceRegistry::InstanceSet_t instances;
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.findService(service, instances);
+            }
+
+            runtime::MqBinaryMessage sendBuffer;
+            sendBuffer.addUnsigned(instances.size());
+            for (auto& instance : instances)
+            {
+                if (!sendBuffer.hasSpaceForString(instance.size()))
+                {
+                    LogWarn() << "Only a part of the " << instances.size() << " instances fits into the response to "
+                              << name;
+                    break;
+                }
+                sendBuffer.addString(instance);
+            }
+            process->sendToMQ(sendBuffer);
+        }
+        else
+        {
+            runtime::MqMessage instanceString;
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                instanceString = m_portManager.findService(service);
+            }
+            process->sendToMQ(instanceString);
+        }
         LogDebug() << "Sent InstanceString to application " << name;
     }
     else
@@ -332,11 +455,15 @@ void ProcessManager::addInterfaceForProcess(const ProcessName_t& name,
                                             capro::Interfaces interface,
                                             const RunnableName_t& runnable) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // create a ReceiverPort
         popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(interface, name, runnable);
 
@@ -358,11 +485,11 @@ void ProcessManager::addInterfaceForProcess(const ProcessName_t& name,
 
 void ProcessManager::sendServiceRegistryChangeCounterToProcess(const ProcessName_t& processName) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-    RouDiProcess* process = getProcessFromList(processName);
-    if (nullptr != process)
+    auto process = findProcess(processName);
+    if (process)
     {
-        // send counter to app as a serialized relative pointer
+        // send counter to app as a serialized relative pointer; the counter lives as long as the PortManager,
+        // therefore the PortManager does not need to be locked
         auto offset = RelativePointer::getOffset(m_mgmtSegmentId, m_portManager.serviceRegistryChangeCounter());
 
         runtime::MqMessage sendBuffer;
@@ -375,14 +502,45 @@ void ProcessManager::sendServiceRegistryChangeCounterToProcess(const ProcessName
     }
 }
 
-void ProcessManager::addApplicationForProcess(const ProcessName_t& name) noexcept
+void ProcessManager::sendServiceRegistryTableToProcess(const ProcessName_t& processName) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    auto process = findProcess(processName);
+    if (process)
+    {
+        // the table lives as long as the PortManager, therefore the PortManager does not need to be locked
+        auto offset = RelativePointer::getOffset(m_mgmtSegmentId, m_portManager.serviceRegistryTable());
 
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+        runtime::MqMessage sendBuffer;
+        sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::SERVICE_REGISTRY_TABLE_ACK)
+                   << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
+        process->sendToMQ(sendBuffer);
+    }
+    else
+    {
+        LogWarn() << "Unknown application " << processName << " requested the service registry table.";
+    }
+}
+
+void ProcessManager::addApplicationForProcess(const ProcessName_t& name) noexcept
+{
+    auto process = findProcess(name);
+    if (process)
     {
-        popo::ApplicationPortData* port = m_portManager.acquireApplicationPortData(name);
+        popo::ApplicationPortData* port{nullptr};
+        {
+            std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+            if (process->isRemoved())
+            {
+                return;
+            }
+            port = m_portManager.acquireApplicationPortData(name);
+        }
+
+        {
+            // the application port is used by monitorProcesses
+            std::lock_guard<std::mutex> g(m_mutex);
+            process->setApplicationPortData(port);
+        }
 
         auto offset = RelativePointer::getOffset(m_mgmtSegmentId, port);
 
@@ -402,11 +560,15 @@ void ProcessManager::addApplicationForProcess(const ProcessName_t& name) noexcep
 void ProcessManager::addRunnableForProcess(const ProcessName_t& processName,
                                            const RunnableName_t& runnableName) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(processName);
-    if (nullptr != process)
+    auto process = findProcess(processName);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         runtime::RunnableData* runnable =
             m_portManager.acquireRunnableData(cxx::string<100>(cxx::TruncateToCapacity, processName),
                                               cxx::string<100>(cxx::TruncateToCapacity, runnableName));
@@ -428,16 +590,24 @@ void ProcessManager::addRunnableForProcess(const ProcessName_t& processName,
     }
 }
 
-void ProcessManager::sendMessageNotSupportedToRuntime(const ProcessName_t& name) noexcept
+void ProcessManager::sendMessageNotSupportedToRuntime(const ProcessName_t& name,
+                                                      const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
-        runtime::MqMessage sendBuffer;
-        sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::MESSAGE_NOT_SUPPORTED);
-        process->sendToMQ(sendBuffer);
+        if (protocol == runtime::MqProtocol::BINARY)
+        {
+            runtime::MqBinaryMessage sendBuffer;
+            sendBuffer.addSigned(static_cast<int64_t>(runtime::MqMessageType::MESSAGE_NOT_SUPPORTED));
+            process->sendToMQ(sendBuffer);
+        }
+        else
+        {
+            runtime::MqMessage sendBuffer;
+            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::MESSAGE_NOT_SUPPORTED);
+            process->sendToMQ(sendBuffer);
+        }
 
         LogError() << "Application " << name << " sent a message, which is not supported by this RouDi";
     }
@@ -447,13 +617,18 @@ void ProcessManager::sendMessageNotSupportedToRuntime(const ProcessName_t& name)
 void ProcessManager::addReceiverForProcess(const ProcessName_t& name,
                                            const capro::ServiceDescription& service,
                                            const RunnableName_t& runnable,
-                                           const PortConfigInfo& portConfigInfo) noexcept
+                                           const PortConfigInfo& portConfigInfo,
+                                           const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // create a ReceiverPort
 
         /// @todo: it might be useful to encapsulate this into some kind of port factory
@@ -469,10 +644,7 @@ void ProcessManager::addReceiverForProcess(const ProcessName_t& name,
         // send ReceiverPort to app as a serialized relative pointer
         auto offset = RelativePointer::getOffset(m_mgmtSegmentId, receiver);
 
-        runtime::MqMessage sendBuffer;
-        sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::CREATE_RECEIVER_ACK)
-                   << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
-        process->sendToMQ(sendBuffer);
+        sendPortAckToProcess(*process, protocol, runtime::MqMessageType::CREATE_RECEIVER_ACK, offset);
 
         LogDebug() << "Created new ReceiverPortImpl for application " << name;
     }
@@ -486,13 +658,18 @@ void ProcessManager::addReceiverForProcess(const ProcessName_t& name,
 void ProcessManager::addSenderForProcess(const ProcessName_t& name,
                                          const capro::ServiceDescription& service,
                                          const RunnableName_t& runnable,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+                                         const PortConfigInfo& portConfigInfo,
+                                         const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // create a SenderPort
         auto maybeSender = m_portManager.acquireSenderPortData(
             service, name, process->getPayloadMemoryManager(), runnable, portConfigInfo);
@@ -502,22 +679,18 @@ void ProcessManager::addSenderForProcess(const ProcessName_t& name,
             // send SenderPort to app as a serialized relative pointer
             auto offset = RelativePointer::getOffset(m_mgmtSegmentId, maybeSender.get_value());
 
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::CREATE_SENDER_ACK)
-                       << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
-            process->sendToMQ(sendBuffer);
+            sendPortAckToProcess(*process, protocol, runtime::MqMessageType::CREATE_SENDER_ACK, offset);
 
             LogDebug() << "Created new SenderPortImpl for application " << name;
         }
         else
         {
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::ERROR);
-            sendBuffer << runtime::mqMessageErrorTypeToString( // map error codes
-                (maybeSender.get_error() == PortPoolError::UNIQUE_SENDER_PORT_ALREADY_EXISTS
-                     ? runtime::MqMessageErrorType::NO_UNIQUE_CREATED
-                     : runtime::MqMessageErrorType::SENDERLIST_FULL));
-            process->sendToMQ(sendBuffer);
+            sendErrorToProcess(*process,
+                               protocol,
+                               // map error codes
+                               (maybeSender.get_error() == PortPoolError::UNIQUE_SENDER_PORT_ALREADY_EXISTS
+                                    ? runtime::MqMessageErrorType::NO_UNIQUE_CREATED
+                                    : runtime::MqMessageErrorType::SENDERLIST_FULL));
             LogError() << "Could not create SenderPortImpl for application " << name;
         }
     }
@@ -531,13 +704,18 @@ void ProcessManager::addSubscriberForProcess(const ProcessName_t& name,
                                              const capro::ServiceDescription& service,
                                              const uint64_t& historyRequest,
                                              const RunnableName_t& runnable,
-                                             const PortConfigInfo& portConfigInfo) noexcept
+                                             const PortConfigInfo& portConfigInfo,
+                                             const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // create a SubscriberPort
         auto maybeSubscriber =
             m_portManager.acquireSubscriberPortData(service, historyRequest, name, runnable, portConfigInfo);
@@ -547,19 +725,13 @@ void ProcessManager::addSubscriberForProcess(const ProcessName_t& name,
             // send SubscriberPort to app as a serialized relative pointer
             auto offset = RelativePointer::getOffset(m_mgmtSegmentId, maybeSubscriber.get_value());
 
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::CREATE_SUBSCRIBER_ACK)
-                       << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
-            process->sendToMQ(sendBuffer);
+            sendPortAckToProcess(*process, protocol, runtime::MqMessageType::CREATE_SUBSCRIBER_ACK, offset);
 
             LogDebug() << "Created new SubscriberPort for application " << name;
         }
         else
         {
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::ERROR);
-            sendBuffer << runtime::mqMessageErrorTypeToString(runtime::MqMessageErrorType::SUBSCRIBER_LIST_FULL);
-            process->sendToMQ(sendBuffer);
+            sendErrorToProcess(*process, protocol, runtime::MqMessageErrorType::SUBSCRIBER_LIST_FULL);
             LogError() << "Could not create SubscriberPort for application " << name;
         }
     }
@@ -573,13 +745,18 @@ void ProcessManager::addPublisherForProcess(const ProcessName_t& name,
                                             const capro::ServiceDescription& service,
                                             const uint64_t& historyCapacity,
                                             const RunnableName_t& runnable,
-                                            const PortConfigInfo& portConfigInfo) noexcept
+                                            const PortConfigInfo& portConfigInfo,
+                                            const runtime::MqProtocol protocol) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(name);
-    if (nullptr != process)
+    auto process = findProcess(name);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // create a PublisherPort
         auto maybePublisher = m_portManager.acquirePublisherPortData(
             service, historyCapacity, name, process->getPayloadMemoryManager(), runnable, portConfigInfo);
@@ -589,22 +766,18 @@ void ProcessManager::addPublisherForProcess(const ProcessName_t& name,
             // send PublisherPort to app as a serialized relative pointer
             auto offset = RelativePointer::getOffset(m_mgmtSegmentId, maybePublisher.get_value());
 
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::CREATE_PUBLISHER_ACK)
-                       << std::to_string(offset) << std::to_string(m_mgmtSegmentId);
-            process->sendToMQ(sendBuffer);
+            sendPortAckToProcess(*process, protocol, runtime::MqMessageType::CREATE_PUBLISHER_ACK, offset);
 
             LogDebug() << "Created new PublisherPort for application " << name;
         }
         else
         {
-            runtime::MqMessage sendBuffer;
-            sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::ERROR);
-            sendBuffer << runtime::mqMessageErrorTypeToString( // map error codes
-                (maybePublisher.get_error() == PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS
-                     ? runtime::MqMessageErrorType::NO_UNIQUE_CREATED
-                     : runtime::MqMessageErrorType::PUBLISHER_LIST_FULL));
-            process->sendToMQ(sendBuffer);
+            sendErrorToProcess(*process,
+                               protocol,
+                               // map error codes
+                               (maybePublisher.get_error() == PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS
+                                    ? runtime::MqMessageErrorType::NO_UNIQUE_CREATED
+                                    : runtime::MqMessageErrorType::PUBLISHER_LIST_FULL));
             LogError() << "Could not create PublisherPort for application " << name;
         }
     }
@@ -616,11 +789,15 @@ void ProcessManager::addPublisherForProcess(const ProcessName_t& name,
 
 void ProcessManager::addConditionVariableForProcess(const ProcessName_t& processName) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
-
-    RouDiProcess* process = getProcessFromList(processName);
-    if (nullptr != process)
+    auto process = findProcess(processName);
+    if (process)
     {
+        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+        if (process->isRemoved())
+        {
+            return;
+        }
+
         // Try to create a condition variable
         m_portManager.acquireConditionVariableData()
             .and_then([&](popo::ConditionVariableData* condVar) {
@@ -660,36 +837,103 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
 void ProcessManager::run() noexcept
 {
     monitorProcesses();
-    discoveryUpdate();
-    std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.milliSeconds<int64_t>()));
+
+    // the full discovery is a fallback for changes whose notification got lost, it also handles the notified changes
+    const auto monitoringTime = std::chrono::steady_clock::now();
+    if (monitoringTime >= m_nextFullDiscovery)
+    {
+        m_nextFullDiscovery = monitoringTime + std::chrono::nanoseconds(FULL_DISCOVERY_INTERVAL.nanoSeconds<int64_t>());
+        discoveryUpdate();
+    }
+    else
+    {
+        notifiedDiscoveryUpdate();
+    }
+
+    // the ports notify the discovery trigger on changes, therefore the discovery is done as soon as there is something
+    // to do and not only once per interval; the interval is only needed for the monitoring of the processes
+    const auto nextMonitoring = monitoringTime + std::chrono::nanoseconds(DISCOVERY_INTERVAL.nanoSeconds<int64_t>());
+    auto now = std::chrono::steady_clock::now();
+    while (now < nextMonitoring)
+    {
+        const auto timeUntilMonitoring = std::chrono::duration_cast<std::chrono::nanoseconds>(nextMonitoring - now);
+        if (m_portManager.waitForDiscoveryTrigger(units::Duration(timeUntilMonitoring)))
+        {
+            notifiedDiscoveryUpdate();
+        }
+        now = std::chrono::steady_clock::now();
+    }
 }
 
 SenderPortType ProcessManager::addIntrospectionSenderPort(const capro::ServiceDescription& service,
                                                           const ProcessName_t& process_name) noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
 
     return SenderPortType(
         m_portManager.acquireSenderPortData(service, process_name, m_introspectionMemoryManager).get_value());
 }
 
-RouDiProcess* ProcessManager::getProcessFromList(const ProcessName_t& name) noexcept
+void ProcessManager::sendPortAckToProcess(RouDiProcess& process,
+                                          const runtime::MqProtocol protocol,
+                                          const runtime::MqMessageType ackType,
+                                          const RelativePointer::offset_t offset) noexcept
+{
+    if (protocol == runtime::MqProtocol::BINARY)
+    {
+        runtime::MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(ackType)).addUnsigned(offset).addUnsigned(m_mgmtSegmentId);
+        process.sendToMQ(sendBuffer);
+    }
+    else
+    {
+        runtime::MqMessage sendBuffer;
+        sendBuffer << runtime::mqMessageTypeToString(ackType) << std::to_string(offset)
+                   << std::to_string(m_mgmtSegmentId);
+        process.sendToMQ(sendBuffer);
+    }
+}
+
+void ProcessManager::sendErrorToProcess(RouDiProcess& process,
+                                        const runtime::MqProtocol protocol,
+                                        const runtime::MqMessageErrorType error) noexcept
 {
-    RouDiProcess* processPtr = nullptr;
+    if (protocol == runtime::MqProtocol::BINARY)
+    {
+        runtime::MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(runtime::MqMessageType::ERROR))
+            .addSigned(static_cast<int64_t>(error));
+        process.sendToMQ(sendBuffer);
+    }
+    else
+    {
+        runtime::MqMessage sendBuffer;
+        sendBuffer << runtime::mqMessageTypeToString(runtime::MqMessageType::ERROR)
+                   << runtime::mqMessageErrorTypeToString(error);
+        process.sendToMQ(sendBuffer);
+    }
+}
 
+std::shared_ptr<RouDiProcess> ProcessManager::getProcessFromList(const ProcessName_t& name) noexcept
+{
     typename ProcessList_t::iterator it = m_processList.begin();
     const typename ProcessList_t::iterator itEnd = m_processList.end();
 
     for (; itEnd != it; ++it)
     {
-        if (name == it->getName())
+        if (name == (*it)->getName())
         {
-            processPtr = &(*it);
-            break;
+            return *it;
         }
     }
 
-    return processPtr;
+    return nullptr;
+}
+
+std::shared_ptr<RouDiProcess> ProcessManager::findProcess(const ProcessName_t& name) noexcept
+{
+    std::lock_guard<std::mutex> g(m_mutex);
+    return getProcessFromList(name);
 }
 
 void ProcessManager::monitorProcesses() noexcept
@@ -701,17 +945,20 @@ void ProcessManager::monitorProcesses() noexcept
     auto processIterator = m_processList.begin();
     while (processIterator != m_processList.end())
     {
-        if (processIterator->isMonitored())
+        auto& process = *processIterator;
+        if (process->isMonitored())
         {
-            auto timediff_ms = std::chrono::duration_cast<std::chrono::milliseconds>(currentTimestamp
-                                                                                     - processIterator->getTimestamp())
-                                   .count();
+            process->updateTimestampFromKeepAliveCounter(currentTimestamp);
+
+            auto timediff_ms =
+                std::chrono::duration_cast<std::chrono::milliseconds>(currentTimestamp - process->getTimestamp())
+                    .count();
 
             static_assert(PROCESS_KEEP_ALIVE_TIMEOUT > PROCESS_KEEP_ALIVE_INTERVAL, "keep alive timeout too small");
             if (std::chrono::milliseconds(timediff_ms)
                 > std::chrono::milliseconds(PROCESS_KEEP_ALIVE_TIMEOUT.milliSeconds<int64_t>()))
             {
-                LogWarn() << "Application " << processIterator->getName() << " not responding (last response "
+                LogWarn() << "Application " << process->getName() << " not responding (last response "
                           << timediff_ms << " milliseconds ago) --> removing it";
 
                 // note: if we would want to use the removeProcess function, it would search for the process again (but
@@ -720,12 +967,7 @@ void ProcessManager::monitorProcesses() noexcept
                 // delete all associated receiver and sender impl in shared
                 // memory and the associated RouDi discovery ports
                 // @todo Check if ShmManager and Process Manager end up in unintended condition
-                m_portManager.deletePortsOfProcess(processIterator->getName());
-
-                m_processIntrospection->removeProcess(processIterator->getPid());
-
-                // delete application
-                processIterator = m_processList.erase(processIterator);
+                processIterator = eraseProcess(processIterator);
                 continue; // erase returns first element after the removed one --> skip iterator increment
             }
         }
@@ -735,10 +977,17 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
-    std::lock_guard<std::mutex> g(m_mutex);
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
 
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::notifiedDiscoveryUpdate() noexcept
+{
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+
+    m_portManager.doDiscoveryOfNotifiedPorts();
+}
+
 } // namespace roudi
 } // namespace iox
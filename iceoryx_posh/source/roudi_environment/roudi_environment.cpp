@@ -33,12 +33,18 @@ RouDiEnvironment::RouDiEnvironment(BaseCTor, const uint16_t uniqueRouDiId)
 
 RouDiEnvironment::RouDiEnvironment(const RouDiConfig_t& roudiConfig,
                                    config::MonitoringMode monitoringMode,
-                                   const uint16_t uniqueRouDiId)
+                                   const uint16_t uniqueRouDiId,
+                                   const uint32_t numberOfMqWorkerThreads)
     : RouDiEnvironment(BaseCTor::BASE, uniqueRouDiId)
 {
     m_roudiComponents = std::unique_ptr<IceOryxRouDiComponents>(new IceOryxRouDiComponents(roudiConfig));
-    m_roudiApp = std::unique_ptr<RouDi>(
-        new RouDi(m_roudiComponents->m_rouDiMemoryManager, m_roudiComponents->m_portManager, monitoringMode, false));
+    m_roudiApp = std::unique_ptr<RouDi>(new RouDi(m_roudiComponents->m_rouDiMemoryManager,
+                                                  m_roudiComponents->m_portManager,
+                                                  monitoringMode,
+                                                  false,
+                                                  RouDi::MQThreadStart::IMMEDIATE,
+                                                  version::CompatibilityCheckLevel::PATCH,
+                                                  numberOfMqWorkerThreads));
 }
 
 RouDiEnvironment::~RouDiEnvironment()
@@ -0,0 +1,323 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint8_t MqBinaryMessage::MAGIC;
+constexpr uint8_t MqBinaryMessage::VERSION;
+constexpr uint32_t MqBinaryMessage::CAPACITY;
+constexpr uint32_t MqBinaryMessage::HEADER_SIZE;
+constexpr uint32_t MqBinaryMessage::FIELD_TYPE_SIZE;
+
+MqBinaryMessage::MqBinaryMessage() noexcept
+{
+    clearMessage();
+}
+
+MqBinaryMessage& MqBinaryMessage::addUnsigned(const uint64_t value) noexcept
+{
+    appendField(FieldType::UNSIGNED, &value, sizeof(value));
+    return *this;
+}
+
+MqBinaryMessage& MqBinaryMessage::addSigned(const int64_t value) noexcept
+{
+    appendField(FieldType::SIGNED, &value, sizeof(value));
+    return *this;
+}
+
+MqBinaryMessage& MqBinaryMessage::addString(const char* const value, const uint64_t length) noexcept
+{
+    if (length > std::numeric_limits<uint16_t>::max()
+        || m_size + FIELD_TYPE_SIZE + sizeof(uint16_t) + length > CAPACITY)
+    {
+        m_isValid = false;
+        return *this;
+    }
+
+    const uint16_t stringLength = static_cast<uint16_t>(length);
+    if (appendField(FieldType::STRING, &stringLength, sizeof(stringLength)))
+    {
+        std::memcpy(&m_buffer[m_size], value, stringLength);
+        m_size += stringLength;
+
+        auto header = readHeader();
+        header.payloadSize = m_size - HEADER_SIZE;
+        writeHeader(header);
+    }
+    return *this;
+}
+
+MqBinaryMessage& MqBinaryMessage::addServiceDescription(const capro::ServiceDescription& service) noexcept
+{
+    auto classHash = service.getClassHash();
+    addString(service.getServiceIDString())
+        .addString(service.getInstanceIDString())
+        .addString(service.getEventIDString())
+        .addUnsigned(classHash[0u])
+        .addUnsigned(classHash[1u])
+        .addUnsigned(classHash[2u])
+        .addUnsigned(classHash[3u])
+        .addUnsigned(static_cast<uint64_t>(service.getSourceInterface()))
+        .addUnsigned(static_cast<uint64_t>(service.getScope()))
+        .addUnsigned(service.hasServiceOnlyDescription() ? 1u : 0u);
+    return *this;
+}
+
+MqBinaryMessage& MqBinaryMessage::addPortConfigInfo(const PortConfigInfo& portConfigInfo) noexcept
+{
+    addUnsigned(portConfigInfo.portType)
+        .addUnsigned(portConfigInfo.memoryInfo.deviceId)
+        .addUnsigned(portConfigInfo.memoryInfo.memoryType);
+    return *this;
+}
+
+bool MqBinaryMessage::readUnsigned(uint64_t& value) noexcept
+{
+    uint32_t position{0u};
+    if (!readFieldType(FieldType::UNSIGNED, position) || position + sizeof(value) > m_size)
+    {
+        return false;
+    }
+
+    std::memcpy(&value, &m_buffer[position], sizeof(value));
+    m_readPosition = position + static_cast<uint32_t>(sizeof(value));
+    return true;
+}
+
+bool MqBinaryMessage::readSigned(int64_t& value) noexcept
+{
+    uint32_t position{0u};
+    if (!readFieldType(FieldType::SIGNED, position) || position + sizeof(value) > m_size)
+    {
+        return false;
+    }
+
+    std::memcpy(&value, &m_buffer[position], sizeof(value));
+    m_readPosition = position + static_cast<uint32_t>(sizeof(value));
+    return true;
+}
+
+bool MqBinaryMessage::readServiceDescription(capro::ServiceDescription& service) noexcept
+{
+    const auto readPosition = m_readPosition;
+
+    capro::IdString serviceString;
+    capro::IdString instanceString;
+    capro::IdString eventString;
+    uint64_t classHash[4u];
+    uint64_t interfaceSource{0u};
+    uint64_t scope{0u};
+    uint64_t hasServiceOnlyDescription{0u};
+
+    if (!(readString(serviceString) && readString(instanceString) && readString(eventString)
+          && readUnsigned(classHash[0u]) && readUnsigned(classHash[1u]) && readUnsigned(classHash[2u])
+          && readUnsigned(classHash[3u]) && readUnsigned(interfaceSource) && readUnsigned(scope)
+          && readUnsigned(hasServiceOnlyDescription)))
+    {
+        m_readPosition = readPosition;
+        return false;
+    }
+
+    // the same rules as for the deserialization of the text protocol apply, the ids are derived from the strings
+    if (interfaceSource > static_cast<uint64_t>(capro::Interfaces::INTERFACE_END))
+    {
+        interfaceSource = static_cast<uint64_t>(capro::Interfaces::INTERFACE_END);
+    }
+    if (scope > static_cast<uint64_t>(capro::Scope::INVALID))
+    {
+        scope = static_cast<uint64_t>(capro::Scope::INVALID);
+    }
+
+    service = capro::ServiceDescription(serviceString,
+                                        instanceString,
+                                        eventString,
+                                        {static_cast<uint32_t>(classHash[0u]),
+                                         static_cast<uint32_t>(classHash[1u]),
+                                         static_cast<uint32_t>(classHash[2u]),
+                                         static_cast<uint32_t>(classHash[3u])},
+                                        static_cast<capro::Interfaces>(interfaceSource));
+    service.setScope(static_cast<capro::Scope>(scope));
+    if (hasServiceOnlyDescription != 0u)
+    {
+        service.setServiceOnlyDescription();
+    }
+    return true;
+}
+
+bool MqBinaryMessage::readPortConfigInfo(PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto readPosition = m_readPosition;
+
+    uint64_t portType{0u};
+    uint64_t deviceId{0u};
+    uint64_t memoryType{0u};
+    if (!(readUnsigned(portType) && readUnsigned(deviceId) && readUnsigned(memoryType)))
+    {
+        m_readPosition = readPosition;
+        return false;
+    }
+
+    portConfigInfo = PortConfigInfo(static_cast<uint32_t>(portType),
+                                    static_cast<uint32_t>(deviceId),
+                                    static_cast<uint32_t>(memoryType));
+    return true;
+}
+
+bool MqBinaryMessage::hasSpaceForString(const uint64_t length) const noexcept
+{
+    return m_isValid && length <= std::numeric_limits<uint16_t>::max()
+           && m_size + FIELD_TYPE_SIZE + sizeof(uint16_t) + length <= CAPACITY;
+}
+
+void MqBinaryMessage::resetReadPosition() noexcept
+{
+    m_readPosition = HEADER_SIZE;
+}
+
+uint32_t MqBinaryMessage::getNumberOfFields() const noexcept
+{
+    return readHeader().numberOfFields;
+}
+
+bool MqBinaryMessage::isValid() const noexcept
+{
+    return m_isValid;
+}
+
+void MqBinaryMessage::clearMessage() noexcept
+{
+    writeHeader({MAGIC, VERSION, 0u, 0u});
+    m_size = HEADER_SIZE;
+    m_readPosition = HEADER_SIZE;
+    m_isValid = true;
+}
+
+const void* MqBinaryMessage::getData() const noexcept
+{
+    return m_buffer;
+}
+
+uint32_t MqBinaryMessage::getSize() const noexcept
+{
+    return m_size;
+}
+
+void* MqBinaryMessage::getReceiveBuffer() noexcept
+{
+    return m_buffer;
+}
+
+bool MqBinaryMessage::setReceivedSize(const uint64_t receivedSize) noexcept
+{
+    m_readPosition = HEADER_SIZE;
+    m_isValid = false;
+    m_size = HEADER_SIZE;
+
+    if (receivedSize < HEADER_SIZE || receivedSize > CAPACITY || !isBinaryMessage(m_buffer, receivedSize))
+    {
+        return false;
+    }
+
+    auto header = readHeader();
+    if (header.version != VERSION || header.payloadSize != receivedSize - HEADER_SIZE)
+    {
+        return false;
+    }
+
+    m_size = static_cast<uint32_t>(receivedSize);
+    m_isValid = true;
+    return true;
+}
+
+bool MqBinaryMessage::isBinaryMessage(const void* const data, const uint64_t size) noexcept
+{
+    return size > 0u && *static_cast<const uint8_t*>(data) == MAGIC;
+}
+
+bool MqBinaryMessage::appendField(const FieldType type, const void* const value, const uint32_t valueSize) noexcept
+{
+    if (!m_isValid || m_size + FIELD_TYPE_SIZE + valueSize > CAPACITY)
+    {
+        m_isValid = false;
+        return false;
+    }
+
+    std::memcpy(&m_buffer[m_size], &type, FIELD_TYPE_SIZE);
+    std::memcpy(&m_buffer[m_size + FIELD_TYPE_SIZE], value, valueSize);
+    m_size += FIELD_TYPE_SIZE + valueSize;
+
+    auto header = readHeader();
+    ++header.numberOfFields;
+    header.payloadSize = m_size - HEADER_SIZE;
+    writeHeader(header);
+    return true;
+}
+
+bool MqBinaryMessage::readFieldType(const FieldType expectedType, uint32_t& position) const noexcept
+{
+    if (!m_isValid || m_readPosition + FIELD_TYPE_SIZE > m_size)
+    {
+        return false;
+    }
+
+    FieldType type;
+    std::memcpy(&type, &m_buffer[m_readPosition], FIELD_TYPE_SIZE);
+    position = m_readPosition + FIELD_TYPE_SIZE;
+    return type == expectedType;
+}
+
+bool MqBinaryMessage::readStringView(const char*& value, uint16_t& length) noexcept
+{
+    uint32_t position{0u};
+    uint16_t stringLength{0u};
+    if (!readFieldType(FieldType::STRING, position) || position + sizeof(stringLength) > m_size)
+    {
+        return false;
+    }
+
+    std::memcpy(&stringLength, &m_buffer[position], sizeof(stringLength));
+    position += static_cast<uint32_t>(sizeof(stringLength));
+    if (position + stringLength > m_size)
+    {
+        return false;
+    }
+
+    value = reinterpret_cast<const char*>(&m_buffer[position]);
+    length = stringLength;
+    m_readPosition = position + stringLength;
+    return true;
+}
+
+MqBinaryMessage::Header MqBinaryMessage::readHeader() const noexcept
+{
+    Header header;
+    std::memcpy(&header, m_buffer, HEADER_SIZE);
+    return header;
+}
+
+void MqBinaryMessage::writeHeader(const Header& header) noexcept
+{
+    std::memcpy(m_buffer, &header, HEADER_SIZE);
+}
+
+} // namespace runtime
+} // namespace iox
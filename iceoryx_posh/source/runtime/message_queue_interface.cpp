@@ -22,6 +22,7 @@
 #include "iceoryx_utils/internal/posix_wrapper/timespec.hpp"
 #include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
 
+#include <cstring>
 #include <thread>
 
 namespace iox
@@ -144,6 +145,80 @@ bool MqBase::timedSend(const MqMessage& msg, units::Duration timeout) const noex
     return !m_mq.timedSend(msg.getMessage(), timeout).or_else(logLengthError).has_error();
 }
 
+bool MqBase::receive(MqBinaryMessage& answer) const noexcept
+{
+    auto receivedSize = m_mq.receive(answer.getReceiveBuffer(), MqBinaryMessage::CAPACITY);
+    if (receivedSize.has_error())
+    {
+        return false;
+    }
+
+    return answer.setReceivedSize(receivedSize.get_value());
+}
+
+bool MqBase::timedReceive(const units::Duration timeout, MqBinaryMessage& answer) const noexcept
+{
+    auto receivedSize = m_mq.timedReceive(answer.getReceiveBuffer(), MqBinaryMessage::CAPACITY, timeout);
+    if (receivedSize.has_error())
+    {
+        return false;
+    }
+
+    return answer.setReceivedSize(receivedSize.get_value());
+}
+
+cxx::optional<MqProtocol> MqBase::timedReceiveAnyProtocol(const units::Duration timeout,
+                                                          MqMessage& textAnswer,
+                                                          MqBinaryMessage& binaryAnswer) const noexcept
+{
+    // the message is received into the buffer of the binary message, a text message is copied out of it afterwards
+    auto buffer = binaryAnswer.getReceiveBuffer();
+    auto receivedSize = m_mq.timedReceive(buffer, MqBinaryMessage::CAPACITY, timeout);
+    if (receivedSize.has_error())
+    {
+        return cxx::nullopt;
+    }
+
+    if (MqBinaryMessage::isBinaryMessage(buffer, receivedSize.get_value()))
+    {
+        if (!binaryAnswer.setReceivedSize(receivedSize.get_value()))
+        {
+            LogError() << "The received binary message is not valid";
+            return cxx::nullopt;
+        }
+        return MqProtocol::BINARY;
+    }
+
+    auto text = static_cast<const char*>(buffer);
+    if (!MqBase::setMessageFromString(std::string(text, strnlen(text, receivedSize.get_value())).c_str(), textAnswer))
+    {
+        return cxx::nullopt;
+    }
+    return MqProtocol::TEXT;
+}
+
+bool MqBase::send(const MqBinaryMessage& msg) const noexcept
+{
+    if (!msg.isValid())
+    {
+        LogError() << "Trying to send an invalid binary message with mq_send()";
+        return false;
+    }
+
+    return !m_mq.send(msg.getData(), msg.getSize()).has_error();
+}
+
+bool MqBase::timedSend(const MqBinaryMessage& msg, units::Duration timeout) const noexcept
+{
+    if (!msg.isValid())
+    {
+        LogError() << "Trying to send an invalid binary message with mq_timedsend()";
+        return false;
+    }
+
+    return !m_mq.timedSend(msg.getData(), msg.getSize(), timeout).has_error();
+}
+
 const std::string& MqBase::getInterfaceName() const noexcept
 {
     return m_interfaceName;
@@ -219,10 +294,12 @@ void MqInterfaceCreator::cleanupResource()
 
 MqRuntimeInterface::MqRuntimeInterface(const std::string& roudiName,
                                        const std::string& appName,
-                                       const units::Duration roudiWaitingTimeout) noexcept
+                                       const units::Duration roudiWaitingTimeout,
+                                       const MqProtocol protocol) noexcept
     : m_appName(appName)
     , m_AppMqInterface(appName)
     , m_RoudiMqInterface(roudiName)
+    , m_protocol(protocol)
 {
     posix::Timer timer(roudiWaitingTimeout);
 
@@ -268,14 +345,7 @@ MqRuntimeInterface::MqRuntimeInterface(const std::string& roudiName,
             transmissionTimestamp = timestamp;
 
             // send MqMessageType::REG to RouDi
-
-            MqMessage sendBuffer;
-            sendBuffer << mqMessageTypeToString(MqMessageType::REG) << m_appName << std::to_string(getpid())
-                       << std::to_string(posix::PosixUser::getUserOfCurrentProcess().getID())
-                       << std::to_string(transmissionTimestamp)
-                       << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
-
-            bool successfullySent = m_RoudiMqInterface.timedSend(sendBuffer, 100_ms);
+            bool successfullySent = sendRegisterRequest(transmissionTimestamp);
 
             if (successfullySent)
             {
@@ -351,6 +421,28 @@ bool MqRuntimeInterface::sendRequestToRouDi(const MqMessage& msg, MqMessage& ans
     return true;
 }
 
+bool MqRuntimeInterface::sendRequestToRouDi(const MqBinaryMessage& msg, MqBinaryMessage& answer) noexcept
+{
+    if (!m_RoudiMqInterface.send(msg))
+    {
+        LogError() << "Could not send request via RouDi messagequeue interface.\n";
+        return false;
+    }
+
+    if (!m_AppMqInterface.receive(answer))
+    {
+        LogError() << "Could not receive request via App messagequeue interface.\n";
+        return false;
+    }
+
+    return true;
+}
+
+MqProtocol MqRuntimeInterface::getProtocol() const noexcept
+{
+    return m_protocol;
+}
+
 bool MqRuntimeInterface::sendMessageToRouDi(const MqMessage& msg) noexcept
 {
     if (!m_RoudiMqInterface.send(msg))
@@ -404,39 +496,18 @@ MqRuntimeInterface::RegAckResult MqRuntimeInterface::waitForRegAck(int64_t trans
     size_t retryCounter = 0;
     while (retryCounter++ < MAX_RETRY_COUNT)
     {
-        MqMessage receiveBuffer;
-        // wait for MqMessageType::REG_ACK from RouDi for 1 seconds
-        if (m_AppMqInterface.timedReceive(1_s, receiveBuffer))
+        int64_t receivedTimestamp{0};
+        bool receivedRegAck = (m_protocol == MqProtocol::BINARY) ? receiveBinaryRegAck(receivedTimestamp)
+                                                                 : receiveTextRegAck(receivedTimestamp);
+        if (receivedRegAck)
         {
-            std::string cmd = receiveBuffer.getElementAtIndex(0);
-
-            if (stringToMqMessageType(cmd.c_str()) == MqMessageType::REG_ACK)
+            if (transmissionTimestamp == receivedTimestamp)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 5;
-                if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
-                {
-                    errorHandler(Error::kMQ_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
-                }
-
-                // read out the shared memory base address and save it
-                m_shmTopicSize = strtoull(receiveBuffer.getElementAtIndex(1).c_str(), nullptr, 10);
-                m_segmentManager = receiveBuffer.getElementAtIndex(2);
-
-                int64_t receivedTimestamp;
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(3).c_str(), receivedTimestamp);
-                cxx::convert::fromString(receiveBuffer.getElementAtIndex(4).c_str(), m_segmentId);
-                if (transmissionTimestamp == receivedTimestamp)
-                {
-                    return RegAckResult::SUCCESS;
-                }
-                else
-                {
-                    LogWarn() << "Received a REG_ACK with an outdated timestamp!";
-                }
+                return RegAckResult::SUCCESS;
             }
             else
             {
-                LogError() << "Wrong response received " << receiveBuffer.getMessage();
+                LogWarn() << "Received a REG_ACK with an outdated timestamp!";
             }
         }
     }
@@ -444,6 +515,93 @@ MqRuntimeInterface::RegAckResult MqRuntimeInterface::waitForRegAck(int64_t trans
     return RegAckResult::TIMEOUT;
 }
 
+bool MqRuntimeInterface::sendRegisterRequest(const int64_t transmissionTimestamp) noexcept
+{
+    if (m_protocol == MqProtocol::BINARY)
+    {
+        auto versionInfo = static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::REG))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addSigned(getpid())
+            .addUnsigned(posix::PosixUser::getUserOfCurrentProcess().getID())
+            .addSigned(transmissionTimestamp)
+            .addString(versionInfo.c_str(), versionInfo.size());
+
+        return m_RoudiMqInterface.timedSend(sendBuffer, 100_ms);
+    }
+
+    MqMessage sendBuffer;
+    sendBuffer << mqMessageTypeToString(MqMessageType::REG) << m_appName << std::to_string(getpid())
+               << std::to_string(posix::PosixUser::getUserOfCurrentProcess().getID())
+               << std::to_string(transmissionTimestamp)
+               << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+
+    return m_RoudiMqInterface.timedSend(sendBuffer, 100_ms);
+}
+
+bool MqRuntimeInterface::receiveTextRegAck(int64_t& receivedTimestamp) noexcept
+{
+    MqMessage receiveBuffer;
+    // wait for MqMessageType::REG_ACK from RouDi for 1 seconds
+    if (!m_AppMqInterface.timedReceive(1_s, receiveBuffer))
+    {
+        return false;
+    }
+
+    std::string cmd = receiveBuffer.getElementAtIndex(0);
+    if (stringToMqMessageType(cmd.c_str()) != MqMessageType::REG_ACK)
+    {
+        LogError() << "Wrong response received " << receiveBuffer.getMessage();
+        return false;
+    }
+
+    constexpr uint32_t REGISTER_ACK_PARAMETERS = 5;
+    if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
+    {
+        errorHandler(Error::kMQ_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
+    }
+
+    // read out the shared memory base address and save it
+    m_shmTopicSize = strtoull(receiveBuffer.getElementAtIndex(1).c_str(), nullptr, 10);
+    m_segmentManager = receiveBuffer.getElementAtIndex(2);
+
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(3).c_str(), receivedTimestamp);
+    cxx::convert::fromString(receiveBuffer.getElementAtIndex(4).c_str(), m_segmentId);
+    return true;
+}
+
+bool MqRuntimeInterface::receiveBinaryRegAck(int64_t& receivedTimestamp) noexcept
+{
+    MqBinaryMessage receiveBuffer;
+    // wait for MqMessageType::REG_ACK from RouDi for 1 seconds
+    if (!m_AppMqInterface.timedReceive(1_s, receiveBuffer))
+    {
+        return false;
+    }
+
+    int64_t cmd{0};
+    if (!receiveBuffer.readSigned(cmd) || static_cast<MqMessageType>(cmd) != MqMessageType::REG_ACK)
+    {
+        LogError() << "Wrong binary response received with " << receiveBuffer.getNumberOfFields() << " fields";
+        return false;
+    }
+
+    uint64_t shmTopicSize{0u};
+    uint64_t segmentManagerOffset{0u};
+    if (!(receiveBuffer.readUnsigned(shmTopicSize) && receiveBuffer.readUnsigned(segmentManagerOffset)
+          && receiveBuffer.readSigned(receivedTimestamp) && receiveBuffer.readUnsigned(m_segmentId)))
+    {
+        errorHandler(Error::kMQ_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
+        return false;
+    }
+
+    m_shmTopicSize = shmTopicSize;
+    m_segmentManager = std::to_string(segmentManagerOffset);
+    return true;
+}
+
 uint64_t MqRuntimeInterface::getSegmentId() const noexcept
 {
     return m_segmentId;
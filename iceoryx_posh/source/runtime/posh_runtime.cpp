@@ -17,6 +17,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+#include "iceoryx_posh/internal/runtime/service_registry_table.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iceoryx_posh/runtime/runnable.hpp"
 #include "iceoryx_utils/cxx/convert.hpp"
@@ -121,17 +122,98 @@ const std::atomic<uint64_t>* PoshRuntime::getServiceRegistryChangeCounter() noex
     }
 }
 
+const ServiceRegistryTable* PoshRuntime::requestServiceRegistryTable() noexcept
+{
+    MqMessage sendBuffer;
+    sendBuffer << mqMessageTypeToString(MqMessageType::SERVICE_REGISTRY_TABLE) << m_appName;
+    MqMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3 == receiveBuffer.getNumberOfElements())
+        && stringToMqMessageType(receiveBuffer.getElementAtIndex(0).c_str())
+               == MqMessageType::SERVICE_REGISTRY_TABLE_ACK)
+    {
+        RelativePointer::offset_t offset;
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(1).c_str(), offset);
+        RelativePointer::id_t segmentId;
+        cxx::convert::fromString(receiveBuffer.getElementAtIndex(2).c_str(), segmentId);
+        auto ptr = RelativePointer::getPtr(segmentId, offset);
+
+        return reinterpret_cast<ServiceRegistryTable*>(ptr);
+    }
+    else
+    {
+        LogWarn() << "unable to request the service registry table, the services are looked up by RouDi: \""
+                  << receiveBuffer.getMessage() << "\"";
+        return nullptr;
+    }
+}
+
+template <typename PortDataType>
+cxx::expected<PortDataType*, MqMessageErrorType>
+PoshRuntime::requestPortFromRoudi(const MqBinaryMessage& sendBuffer,
+                                  const MqMessageType expectedAck,
+                                  const MqMessageErrorType wrongResponseError) noexcept
+{
+    MqBinaryMessage receiveBuffer;
+    int64_t messageType{0};
+    if (!sendRequestToRouDi(sendBuffer, receiveBuffer) || !receiveBuffer.readSigned(messageType))
+    {
+        LogError() << "Request port got no valid binary response from message queue";
+        return cxx::error<MqMessageErrorType>(wrongResponseError);
+    }
+
+    if (static_cast<MqMessageType>(messageType) == expectedAck)
+    {
+        uint64_t offset{0u};
+        uint64_t segmentId{0u};
+        if (receiveBuffer.readUnsigned(offset) && receiveBuffer.readUnsigned(segmentId))
+        {
+            auto ptr = RelativePointer::getPtr(static_cast<RelativePointer::id_t>(segmentId),
+                                               static_cast<RelativePointer::offset_t>(offset));
+            return cxx::success<PortDataType*>(reinterpret_cast<PortDataType*>(ptr));
+        }
+    }
+    else if (static_cast<MqMessageType>(messageType) == MqMessageType::ERROR)
+    {
+        int64_t error{0};
+        if (receiveBuffer.readSigned(error))
+        {
+            LogError() << "Request port received no valid port from RouDi.";
+            return cxx::error<MqMessageErrorType>(static_cast<MqMessageErrorType>(error));
+        }
+    }
+
+    LogError() << "Request port got wrong binary response from message queue with message type " << messageType;
+    return cxx::error<MqMessageErrorType>(wrongResponseError);
+}
+
 /// @deprecated #25
 SenderPortType::MemberType_t* PoshRuntime::getMiddlewareSender(const capro::ServiceDescription& service,
                                                                const cxx::CString100& runnableName,
                                                                const PortConfigInfo& portConfigInfo) noexcept
 {
-    MqMessage sendBuffer;
-    sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_SENDER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << runnableName
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    cxx::expected<SenderPortType::MemberType_t*, MqMessageErrorType> requestedSenderPort =
+        cxx::error<MqMessageErrorType>(MqMessageErrorType::NOTYPE);
+    if (m_MqInterface.getProtocol() == MqProtocol::BINARY)
+    {
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_SENDER))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addServiceDescription(service)
+            .addString(runnableName)
+            .addPortConfigInfo(portConfigInfo);
+
+        requestedSenderPort =
+            requestPortFromRoudi<SenderPortType::MemberType_t>(sendBuffer, MqMessageType::CREATE_SENDER_ACK);
+    }
+    else
+    {
+        MqMessage sendBuffer;
+        sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_SENDER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << runnableName
+                   << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
-    auto requestedSenderPort = requestSenderFromRoudi(sendBuffer);
+        requestedSenderPort = requestSenderFromRoudi(sendBuffer);
+    }
     if (requestedSenderPort.has_error())
     {
         switch (requestedSenderPort.get_error())
@@ -208,6 +290,25 @@ ReceiverPortType::MemberType_t* PoshRuntime::getMiddlewareReceiver(const capro::
                                                                    const cxx::CString100& runnableName,
                                                                    const PortConfigInfo& portConfigInfo) noexcept
 {
+    if (m_MqInterface.getProtocol() == MqProtocol::BINARY)
+    {
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_RECEIVER))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addServiceDescription(service)
+            .addString(runnableName)
+            .addPortConfigInfo(portConfigInfo);
+
+        auto maybeReceiver =
+            requestPortFromRoudi<ReceiverPortType::MemberType_t>(sendBuffer, MqMessageType::CREATE_RECEIVER_ACK);
+        if (maybeReceiver.has_error())
+        {
+            errorHandler(Error::kPOSH__RUNTIME_WRONG_MESSAGE_QUEUE_RESPONSE, nullptr, iox::ErrorLevel::SEVERE);
+            return nullptr;
+        }
+        return maybeReceiver.get_value();
+    }
+
     MqMessage sendBuffer;
     sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_RECEIVER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << runnableName
@@ -253,12 +354,32 @@ PublisherPortUserType::MemberType_t* PoshRuntime::getMiddlewarePublisher(const c
                                                                          const cxx::CString100& runnableName,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    MqMessage sendBuffer;
-    sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << std::to_string(historyCapacity) << runnableName
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    cxx::expected<PublisherPortUserType::MemberType_t*, MqMessageErrorType> maybePublisher =
+        cxx::error<MqMessageErrorType>(MqMessageErrorType::NOTYPE);
+    if (m_MqInterface.getProtocol() == MqProtocol::BINARY)
+    {
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_PUBLISHER))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addServiceDescription(service)
+            .addUnsigned(historyCapacity)
+            .addString(runnableName)
+            .addPortConfigInfo(portConfigInfo);
+
+        maybePublisher = requestPortFromRoudi<PublisherPortUserType::MemberType_t>(
+            sendBuffer,
+            MqMessageType::CREATE_PUBLISHER_ACK,
+            MqMessageErrorType::REQUEST_PUBLISHER_WRONG_MESSAGE_QUEUE_RESPONSE);
+    }
+    else
+    {
+        MqMessage sendBuffer;
+        sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_PUBLISHER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << std::to_string(historyCapacity)
+                   << runnableName << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
-    auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
+        maybePublisher = requestPublisherFromRoudi(sendBuffer);
+    }
     if (maybePublisher.has_error())
     {
         switch (maybePublisher.get_error())
@@ -336,12 +457,32 @@ PoshRuntime::getMiddlewareSubscriber(const capro::ServiceDescription& service,
                                      const cxx::CString100& runnableName,
                                      const PortConfigInfo& portConfigInfo) noexcept
 {
-    MqMessage sendBuffer;
-    sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_SUBSCRIBER) << m_appName
-               << static_cast<cxx::Serialization>(service).toString() << std::to_string(historyRequest) << runnableName
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+    cxx::expected<SubscriberPortUserType::MemberType_t*, MqMessageErrorType> maybeSubscriber =
+        cxx::error<MqMessageErrorType>(MqMessageErrorType::NOTYPE);
+    if (m_MqInterface.getProtocol() == MqProtocol::BINARY)
+    {
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_SUBSCRIBER))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addServiceDescription(service)
+            .addUnsigned(historyRequest)
+            .addString(runnableName)
+            .addPortConfigInfo(portConfigInfo);
+
+        maybeSubscriber = requestPortFromRoudi<SubscriberPortUserType::MemberType_t>(
+            sendBuffer,
+            MqMessageType::CREATE_SUBSCRIBER_ACK,
+            MqMessageErrorType::REQUEST_SUBSCRIBER_WRONG_MESSAGE_QUEUE_RESPONSE);
+    }
+    else
+    {
+        MqMessage sendBuffer;
+        sendBuffer << mqMessageTypeToString(MqMessageType::CREATE_SUBSCRIBER) << m_appName
+                   << static_cast<cxx::Serialization>(service).toString() << std::to_string(historyRequest)
+                   << runnableName << static_cast<cxx::Serialization>(portConfigInfo).toString();
 
-    auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+        maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
+    }
 
     if (maybeSubscriber.has_error())
     {
@@ -471,33 +612,84 @@ RunnableData* PoshRuntime::createRunnable(const RunnableProperty& runnableProper
 cxx::expected<Error> PoshRuntime::findService(const capro::ServiceDescription& serviceDescription,
                                               InstanceContainer& instanceContainer) noexcept
 {
-    MqMessage sendBuffer;
-    sendBuffer << mqMessageTypeToString(MqMessageType::FIND_SERVICE) << m_appName
-               << static_cast<cxx::Serialization>(serviceDescription).toString();
-
-    MqMessage requestResponse;
-
-    if (!sendRequestToRouDi(sendBuffer, requestResponse))
+    uint32_t capacity = static_cast<uint32_t>(instanceContainer.capacity());
+    uint64_t numberOfFoundInstances{0u};
+    uint64_t numberOfReceivedInstances{0u};
+
+    std::call_once(m_serviceRegistryTableOnceFlag,
+                   [this] { m_serviceRegistryTable = this->requestServiceRegistryTable(); });
+
+    InstanceContainer localInstances;
+    if (m_serviceRegistryTable != nullptr
+        && m_serviceRegistryTable->find(serviceDescription.getServiceIDString(),
+                                        serviceDescription.getInstanceIDString(),
+                                        localInstances,
+                                        numberOfFoundInstances))
     {
-        LogError() << "Could not send FIND_SERVICE request to RouDi\n";
-        errorHandler(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ, nullptr, ErrorLevel::MODERATE);
-        return cxx::error<Error>(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ);
+        for (auto& instance : localInstances)
+        {
+            if (numberOfReceivedInstances >= capacity)
+            {
+                break;
+            }
+            instanceContainer.push_back(instance);
+            ++numberOfReceivedInstances;
+        }
     }
+    else if (m_MqInterface.getProtocol() == MqProtocol::BINARY)
+    {
+        MqBinaryMessage sendBuffer;
+        sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::FIND_SERVICE))
+            .addString(m_appName.c_str(), m_appName.size())
+            .addServiceDescription(serviceDescription);
 
-    uint32_t numberOfElements = requestResponse.getNumberOfElements();
-    uint32_t capacity = static_cast<uint32_t>(instanceContainer.capacity());
+        MqBinaryMessage requestResponse;
+
+        if (!sendRequestToRouDi(sendBuffer, requestResponse) || !requestResponse.readUnsigned(numberOfFoundInstances))
+        {
+            LogError() << "Could not send FIND_SERVICE request to RouDi\n";
+            errorHandler(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ, nullptr, ErrorLevel::MODERATE);
+            return cxx::error<Error>(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ);
+        }
 
-    // Limit the instances (max value is the capacity of instanceContainer)
-    uint32_t numberOfInstances = ((numberOfElements > capacity) ? capacity : numberOfElements);
-    for (uint32_t i = 0; i < numberOfInstances; ++i)
+        // RouDi sends only the instances which fit into the response
+        IdString instance;
+        while (numberOfReceivedInstances < capacity && requestResponse.readString(instance))
+        {
+            instanceContainer.push_back(instance);
+            ++numberOfReceivedInstances;
+        }
+    }
+    else
     {
-        IdString instance(iox::cxx::TruncateToCapacity, requestResponse.getElementAtIndex(i).c_str());
-        instanceContainer.push_back(instance);
+        MqMessage sendBuffer;
+        sendBuffer << mqMessageTypeToString(MqMessageType::FIND_SERVICE) << m_appName
+                   << static_cast<cxx::Serialization>(serviceDescription).toString();
+
+        MqMessage requestResponse;
+
+        if (!sendRequestToRouDi(sendBuffer, requestResponse))
+        {
+            LogError() << "Could not send FIND_SERVICE request to RouDi\n";
+            errorHandler(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ, nullptr, ErrorLevel::MODERATE);
+            return cxx::error<Error>(Error::kMQ_INTERFACE__REG_UNABLE_TO_WRITE_TO_ROUDI_MQ);
+        }
+
+        numberOfFoundInstances = requestResponse.getNumberOfElements();
+
+        // Limit the instances (max value is the capacity of instanceContainer)
+        numberOfReceivedInstances = ((numberOfFoundInstances > capacity) ? capacity : numberOfFoundInstances);
+        for (uint32_t i = 0; i < numberOfReceivedInstances; ++i)
+        {
+            IdString instance(iox::cxx::TruncateToCapacity, requestResponse.getElementAtIndex(i).c_str());
+            instanceContainer.push_back(instance);
+        }
     }
 
-    if (numberOfElements > capacity)
+    if (numberOfFoundInstances > numberOfReceivedInstances)
     {
-        LogWarn() << numberOfElements << " instances found for service \"" << serviceDescription.getServiceIDString()
+        LogWarn() << numberOfFoundInstances << " instances found for service \""
+                  << serviceDescription.getServiceIDString()
                   << "\" which is more than supported number of instances(" << MAX_NUMBER_OF_INSTANCES << "\n";
         errorHandler(Error::kPOSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW, nullptr, ErrorLevel::MODERATE);
         return cxx::error<Error>(Error::kPOSH__SERVICE_DISCOVERY_INSTANCE_CONTAINER_OVERFLOW);
@@ -622,10 +814,24 @@ bool PoshRuntime::sendRequestToRouDi(const MqMessage& msg, MqMessage& answer) no
     return m_MqInterface.sendRequestToRouDi(msg, answer);
 }
 
+bool PoshRuntime::sendRequestToRouDi(const MqBinaryMessage& msg, MqBinaryMessage& answer) noexcept
+{
+    // runtime must be thread safe
+    std::lock_guard<std::mutex> g(m_appMqRequestMutex);
+    return m_MqInterface.sendRequestToRouDi(msg, answer);
+}
+
+
 // this is the callback for the m_keepAliveTimer
 void PoshRuntime::sendKeepAlive() noexcept
 {
-    if (!m_MqInterface.sendKeepalive())
+    // the keep alive is signaled in the shared memory, the message queue is only used if there is no application port
+    // or it was already destroyed since RouDi stops to look at the keep alive counter of a destroyed application port
+    if (m_applicationPort && !m_applicationPort.toBeDestroyed())
+    {
+        m_applicationPort.sendKeepAlive();
+    }
+    else if (!m_MqInterface.sendKeepalive())
     {
         LogWarn() << "Error in sending keep alive";
     }
@@ -38,6 +38,10 @@ Runnable::~Runnable() noexcept
     if (m_data)
     {
         m_data->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        if (m_data->m_discoveryTrigger)
+        {
+            m_data->m_discoveryTrigger->notify(popo::DiscoveryTrigger::PortKind::RUNNABLE);
+        }
     }
 }
 
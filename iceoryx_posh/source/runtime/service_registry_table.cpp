@@ -0,0 +1,140 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/runtime/service_registry_table.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace runtime
+{
+constexpr uint32_t ServiceRegistryTable::CAPACITY;
+constexpr uint32_t ServiceRegistryTable::MAX_READ_ATTEMPTS;
+
+bool ServiceRegistryTable::add(const capro::IdString& service, const capro::IdString& instance) noexcept
+{
+    for (uint32_t i = 0U; i < m_size; ++i)
+    {
+        if (m_entries[i].m_service == service && m_entries[i].m_instance == instance)
+        {
+            return true;
+        }
+    }
+
+    beginWrite();
+    bool hasSpace = (m_size < CAPACITY);
+    if (hasSpace)
+    {
+        m_entries[m_size].m_service = service;
+        m_entries[m_size].m_instance = instance;
+        ++m_size;
+    }
+    else
+    {
+        // the missing entry would be found by nobody, from now on RouDi answers the look ups
+        m_isIncomplete = true;
+    }
+    endWrite();
+
+    return hasSpace;
+}
+
+void ServiceRegistryTable::remove(const capro::IdString& service, const capro::IdString& instance) noexcept
+{
+    for (uint32_t i = 0U; i < m_size; ++i)
+    {
+        if (m_entries[i].m_service == service && m_entries[i].m_instance == instance)
+        {
+            beginWrite();
+            // the order of the entries does not matter, the last one fills the gap
+            --m_size;
+            if (i != m_size)
+            {
+                m_entries[i].m_service = m_entries[m_size].m_service;
+                m_entries[i].m_instance = m_entries[m_size].m_instance;
+            }
+            endWrite();
+            return;
+        }
+    }
+}
+
+void ServiceRegistryTable::setLookupByRouDiRequired(const bool required) noexcept
+{
+    m_isLookupByRouDiRequired.store(required, std::memory_order_relaxed);
+}
+
+bool ServiceRegistryTable::find(const capro::IdString& service,
+                                const capro::IdString& instance,
+                                InstanceContainer& instances,
+                                uint64_t& numberOfFoundInstances) const noexcept
+{
+    if (m_isLookupByRouDiRequired.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    const bool isAnyInstance = (instance == capro::IdString(capro::AnyInstanceString));
+    for (uint32_t attempt = 0U; attempt < MAX_READ_ATTEMPTS; ++attempt)
+    {
+        const uint64_t sequence = m_sequence.load(std::memory_order_acquire);
+        if ((sequence & 1U) != 0U)
+        {
+            continue;
+        }
+
+        instances.clear();
+        numberOfFoundInstances = 0U;
+        const bool isIncomplete = m_isIncomplete;
+        // the size is only valid for the current sequence, it must not exceed the capacity while RouDi writes
+        const uint32_t size = std::min(m_size, CAPACITY);
+        for (uint32_t i = 0U; i < size; ++i)
+        {
+            const Entry& entry = m_entries[i];
+            if (entry.m_service == service && (isAnyInstance || entry.m_instance == instance))
+            {
+                ++numberOfFoundInstances;
+                if (instances.size() < instances.capacity())
+                {
+                    instances.push_back(entry.m_instance);
+                }
+            }
+        }
+
+        // the entries must be read before the sequence is checked again
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            return !isIncomplete;
+        }
+    }
+
+    return false;
+}
+
+void ServiceRegistryTable::beginWrite() noexcept
+{
+    m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    // the entries must not be written before the sequence is odd
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void ServiceRegistryTable::endWrite() noexcept
+{
+    m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+}
+
+} // namespace runtime
+} // namespace iox
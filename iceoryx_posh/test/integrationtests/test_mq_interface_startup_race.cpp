@@ -15,12 +15,16 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "test.hpp"
 
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
 #include "iceoryx_posh/internal/runtime/message_queue_message.hpp"
+#include "iceoryx_utils/cxx/convert.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/message_queue.hpp"
 #include "iceoryx_utils/internal/units/duration.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <mutex>
 #include <thread>
 
@@ -30,8 +34,10 @@ using namespace iox::units;
 using namespace iox::posix;
 
 using iox::runtime::MqBase;
+using iox::runtime::MqBinaryMessage;
 using iox::runtime::MqMessage;
 using iox::runtime::MqMessageType;
+using iox::runtime::MqProtocol;
 using iox::runtime::MqRuntimeInterface;
 
 
@@ -47,7 +53,8 @@ class StringToMessage : public MqBase
     using MqBase::setMessageFromString;
 };
 
-class CMqInterfaceStartupRace_test : public Test
+/// @brief the fake RouDi of the tests understands the protocol which is used by the application
+class CMqInterfaceStartupRace_test : public TestWithParam<MqProtocol>
 {
   public:
     CMqInterfaceStartupRace_test()
@@ -70,27 +77,77 @@ class CMqInterfaceStartupRace_test : public Test
         return msg;
     }
 
-    void checkRegRequest(const MqMessage& msg) const
+    /// @brief receives a request in the text or the binary protocol
+    /// @return true if a request was received, otherwise false
+    bool receiveRequest(const IpcChannelType& roudiQueue, const units::Duration timeout)
     {
-        ASSERT_THAT(msg.getNumberOfElements(), Eq(6u));
+        // the queues of the test are created with the default message size which is larger than the binary message
+        char data[IpcChannelType::MAX_MESSAGE_SIZE];
+        auto receivedSize = roudiQueue.timedReceive(data, sizeof(data), timeout);
+        if (receivedSize.has_error())
+        {
+            return false;
+        }
+
+        m_isBinaryRequest = MqBinaryMessage::isBinaryMessage(data, receivedSize.get_value());
+        if (m_isBinaryRequest)
+        {
+            const auto size = std::min<size_t>(receivedSize.get_value(), MqBinaryMessage::CAPACITY);
+            std::memcpy(m_binaryRequest.getReceiveBuffer(), data, size);
+            m_binaryRequest.setReceivedSize(receivedSize.get_value());
+        }
+        else
+        {
+            m_textRequest = getMqMessage(std::string(data, strnlen(data, receivedSize.get_value())));
+        }
+        return true;
+    }
 
-        std::string cmd = msg.getElementAtIndex(0);
-        ASSERT_THAT(cmd.c_str(), StrEq(mqMessageTypeToString(MqMessageType::REG)));
+    /// @brief checks the last received request and stores its transmission timestamp
+    void checkRegRequest()
+    {
+        if (GetParam() == MqProtocol::BINARY)
+        {
+            ASSERT_TRUE(m_isBinaryRequest);
+            ASSERT_TRUE(m_binaryRequest.isValid());
+            ASSERT_THAT(m_binaryRequest.getNumberOfFields(), Eq(6u));
+
+            int64_t cmd{0};
+            ProcessName_t name;
+            int64_t pid{0};
+            uint64_t userId{0u};
+            ASSERT_TRUE(m_binaryRequest.readSigned(cmd));
+            ASSERT_THAT(cmd, Eq(static_cast<int64_t>(MqMessageType::REG)));
+            ASSERT_TRUE(m_binaryRequest.readString(name));
+            ASSERT_THAT(name.c_str(), StrEq(MqAppName));
+            ASSERT_TRUE(m_binaryRequest.readSigned(pid));
+            ASSERT_TRUE(m_binaryRequest.readUnsigned(userId));
+            ASSERT_TRUE(m_binaryRequest.readSigned(m_transmissionTimestamp));
+        }
+        else
+        {
+            ASSERT_FALSE(m_isBinaryRequest);
+            ASSERT_THAT(m_textRequest.getNumberOfElements(), Eq(6u));
 
-        std::string name = msg.getElementAtIndex(1);
-        ASSERT_THAT(name.c_str(), StrEq(MqAppName));
+            std::string cmd = m_textRequest.getElementAtIndex(0);
+            ASSERT_THAT(cmd.c_str(), StrEq(mqMessageTypeToString(MqMessageType::REG)));
+
+            std::string name = m_textRequest.getElementAtIndex(1);
+            ASSERT_THAT(name.c_str(), StrEq(MqAppName));
+
+            constexpr uint32_t INDEX_OF_TIMESTAMP{4};
+            ASSERT_TRUE(
+                cxx::convert::fromString(m_textRequest.getElementAtIndex(INDEX_OF_TIMESTAMP).c_str(),
+                                         m_transmissionTimestamp));
+        }
     }
 
-    void sendRegAck(const MqMessage& oldMsg)
+    void sendRegAck(const int64_t transmissionTimestamp)
     {
         std::lock_guard<std::mutex> lock(m_appQueueMutex);
-        MqMessage regAck;
         constexpr uint32_t DUMMY_SHM_SIZE{37};
         constexpr uint32_t DUMMY_SHM_OFFSET{73};
         constexpr uint32_t DUMMY_SEGMENT_ID{13};
-        constexpr uint32_t INDEX_OF_TIMESTAMP{4};
-        regAck << mqMessageTypeToString(MqMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
-               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID;
 
         if (m_appQueue.has_error())
         {
@@ -98,9 +155,30 @@ class CMqInterfaceStartupRace_test : public Test
         }
         ASSERT_THAT(m_appQueue.has_error(), false);
 
-        m_appQueue->send(regAck.getMessage());
+        if (GetParam() == MqProtocol::BINARY)
+        {
+            MqBinaryMessage regAck;
+            regAck.addSigned(static_cast<int64_t>(MqMessageType::REG_ACK))
+                .addUnsigned(DUMMY_SHM_SIZE)
+                .addUnsigned(DUMMY_SHM_OFFSET)
+                .addSigned(transmissionTimestamp)
+                .addUnsigned(DUMMY_SEGMENT_ID);
+            m_appQueue->send(regAck.getData(), regAck.getSize());
+        }
+        else
+        {
+            MqMessage regAck;
+            regAck << mqMessageTypeToString(MqMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
+                   << transmissionTimestamp << DUMMY_SEGMENT_ID;
+            m_appQueue->send(regAck.getMessage());
+        }
     }
 
+    MqBinaryMessage m_binaryRequest;
+    MqMessage m_textRequest;
+    bool m_isBinaryRequest{false};
+    int64_t m_transmissionTimestamp{0};
+
     /// @note smart_lock in combination with optional is currently not really usable
     std::mutex m_roudiQueueMutex;
     IpcChannelType::result_t m_roudiQueue{
@@ -109,8 +187,13 @@ class CMqInterfaceStartupRace_test : public Test
     IpcChannelType::result_t m_appQueue;
 };
 
+/// we require INSTANTIATE_TEST_CASE_P since we support gtest 1.8 for our safety targets
+INSTANTIATE_TEST_CASE_P(TextAndBinaryProtocol,
+                        CMqInterfaceStartupRace_test,
+                        Values(MqProtocol::TEXT, MqProtocol::BINARY));
+
 #if !defined(__APPLE__)
-TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMq)
+TEST_P(CMqInterfaceStartupRace_test, ObsoleteRouDiMq)
 {
     /// @note this test checks if the application handles the situation when the roudi mqueue was not properly cleaned
     /// up and tries to use the obsolet mqueue while RouDi gets restarted and cleans its resources up and creates a new
@@ -122,22 +205,18 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMq)
         std::lock_guard<std::mutex> lock(m_roudiQueueMutex);
         // ensure that the application already opened the roudi mqueue by waiting until a REG request is sent to the
         // roudi mqueue
-        auto request = m_roudiQueue->timedReceive(15_s);
-        ASSERT_FALSE(request.has_error());
-        auto msg = getMqMessage(request.get_value());
-        checkRegRequest(msg);
+        ASSERT_TRUE(receiveRequest(*m_roudiQueue, 15_s));
+        checkRegRequest();
 
         // simulate the restart of RouDi with the mqueue cleanup
         system(DeleteRouDiMessageQueue);
         auto m_roudiQueue2 = IpcChannelType::create(MQ_ROUDI_NAME, IpcChannelMode::BLOCKING, IpcChannelSide::SERVER);
 
         // check if the app retries to register at RouDi
-        request = m_roudiQueue2->timedReceive(15_s);
-        ASSERT_FALSE(request.has_error());
-        msg = getMqMessage(request.get_value());
-        checkRegRequest(msg);
+        ASSERT_TRUE(receiveRequest(*m_roudiQueue2, 15_s));
+        checkRegRequest();
 
-        sendRegAck(msg);
+        sendRegAck(m_transmissionTimestamp);
 
         while (!shutdown)
         {
@@ -145,13 +224,13 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMq)
         }
     });
 
-    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s);
+    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s, GetParam());
 
     shutdown = true;
     roudi.join();
 }
 
-TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMqWithFullMq)
+TEST_P(CMqInterfaceStartupRace_test, ObsoleteRouDiMqWithFullMq)
 {
     /// @note this test checks if the application handles the situation when the roudi mqueue was not properly cleaned
     /// up and tries to use the obsolet mqueue while RouDi gets restarted and cleans its resources up and creates a new
@@ -174,19 +253,18 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMqWithFullMq)
         auto newRoudi = IpcChannelType::create(MQ_ROUDI_NAME, IpcChannelMode::BLOCKING, IpcChannelSide::SERVER);
 
         // check if the app retries to register at RouDi
-        auto request = newRoudi->timedReceive(15_s);
-        if (request.has_error())
+        auto hasReceivedRequest = receiveRequest(*newRoudi, 15_s);
+        if (!hasReceivedRequest)
         {
             // clear the old mqueue to prevent a deadlock in mq_send to the old roudi mqueue in the app
             while (!m_roudiQueue->timedReceive(1_s).has_error())
             {
             }
         }
-        ASSERT_FALSE(request.has_error());
-        auto msg = getMqMessage(request.get_value());
-        checkRegRequest(msg);
+        ASSERT_TRUE(hasReceivedRequest);
+        checkRegRequest();
 
-        sendRegAck(msg);
+        sendRegAck(m_transmissionTimestamp);
 
         while (!shutdown)
         {
@@ -194,14 +272,14 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRouDiMqWithFullMq)
         }
     });
 
-    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s);
+    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s, GetParam());
 
     shutdown = true;
     roudi.join();
 }
 #endif
 
-TEST_F(CMqInterfaceStartupRace_test, ObsoleteRegAck)
+TEST_P(CMqInterfaceStartupRace_test, ObsoleteRegAck)
 {
     /// @note this test checks if the application handles the situation when it sends an REG request to RouDi,
     /// terminates, gets restarted and sends a new REG request while RouDi has not yet processed the first REG request;
@@ -213,20 +291,12 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRegAck)
     auto roudi = std::thread([&] {
         std::lock_guard<std::mutex> lock(m_roudiQueueMutex);
         // wait for the REG request
-        auto request = m_roudiQueue->timedReceive(5_s);
-        ASSERT_FALSE(request.has_error());
-        auto msg = getMqMessage(request.get_value());
-        checkRegRequest(msg);
+        ASSERT_TRUE(receiveRequest(*m_roudiQueue, 5_s));
+        checkRegRequest();
 
-        MqMessage obsoleteMsg;
-        for (uint32_t i = 0; i < 4; ++i)
-        {
-            obsoleteMsg << msg.getElementAtIndex(i);
-        }
-        // set an invalid timestamp
-        obsoleteMsg << 0;
-        sendRegAck(obsoleteMsg);
-        sendRegAck(msg);
+        // send a response with an invalid timestamp before the valid one
+        sendRegAck(0);
+        sendRegAck(m_transmissionTimestamp);
 
         while (!shutdown)
         {
@@ -234,7 +304,7 @@ TEST_F(CMqInterfaceStartupRace_test, ObsoleteRegAck)
         }
     });
 
-    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s);
+    MqRuntimeInterface dut(MQ_ROUDI_NAME, MqAppName, 35_s, GetParam());
 
     shutdown = true;
     roudi.join();
@@ -64,6 +64,7 @@ class ReceiverPort_MOCK
     MOCK_METHOD0(clearDeliveryFiFo, void());
     MOCK_METHOD0(UnsetCallbackReferences, void());
     MOCK_METHOD0(GetShmSemaphore, iox::posix::Semaphore*());
+    MOCK_METHOD1(setWaiterPolling, void(const bool));
     MOCK_METHOD1(deliver, bool(iox::mepoo::SharedChunk));
 
     MOCK_CONST_METHOD0(getDeliveryFiFoSize, uint64_t());
@@ -71,6 +72,21 @@ class ReceiverPort_MOCK
     MOCK_CONST_METHOD0(getDeliveryFiFoCapacity, uint32_t());
     MOCK_CONST_METHOD0(getCaProServiceDescription, iox::capro::ServiceDescription());
     MOCK_METHOD0(AreCallbackReferencesSet, bool());
+
+    const iox::popo::LatencyHistogram& getSendToDeliverLatency() const noexcept
+    {
+        return m_latencyHistogram;
+    }
+    const iox::popo::LatencyHistogram& getSendToGetLatency() const noexcept
+    {
+        return m_latencyHistogram;
+    }
+    const iox::popo::LatencyHistogram& getSendToReleaseLatency() const noexcept
+    {
+        return m_latencyHistogram;
+    }
+
+    iox::popo::LatencyHistogram m_latencyHistogram;
 };
 
 #endif // IOX_POSH_MOCKS_RECEIVERPORT_MOCK_HPP
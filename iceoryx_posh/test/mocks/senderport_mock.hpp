@@ -51,7 +51,8 @@ class SenderPort_MOCK
     static std::shared_ptr<mock_t> globalDetails;
 
     SenderPort_MOCK() = default;
-    SenderPort_MOCK(iox::popo::SenderPortData* const)
+    SenderPort_MOCK(iox::popo::SenderPortData* const portData)
+        : m_portData(portData)
     {
     }
 
@@ -154,6 +155,11 @@ class SenderPort_MOCK
         }
         return details->getNanosecondsBetweenLastTwoDeliveriesReturn;
     }
+    const iox::popo::LatencyHistogram& getAllocateToSendLatency() const
+    {
+        static iox::popo::LatencyHistogram emptyLatency;
+        return (m_portData != nullptr) ? m_portData->m_allocateToSendLatency : emptyLatency;
+    }
     operator bool() const
     {
         details->isConnectedToMembers++;
@@ -164,6 +170,8 @@ class SenderPort_MOCK
         }
         return details->isConnectedToMembersReturn;
     }
+
+    iox::popo::SenderPortData* m_portData{nullptr};
 };
 
 #endif // IOX_POSH_MOCKS_SENDERPORT_MOCK_HPP
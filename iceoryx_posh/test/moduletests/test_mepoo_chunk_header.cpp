@@ -0,0 +1,109 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_utils/cxx/helplets.hpp"
+#include "test.hpp"
+
+#include <limits>
+#include <new>
+
+using namespace ::testing;
+
+using iox::mepoo::ChunkHeader;
+using iox::mepoo::ChunkLayout;
+
+class ChunkHeader_test : public Test
+{
+  public:
+    /// @brief places a ChunkHeader with the given layout at an offset to a MAX_PAYLOAD_ALIGNMENT aligned address, the
+    /// offset must be a multiple of the alignment of the ChunkHeader
+    ChunkHeader* createChunkHeader(const uint64_t offset, const ChunkLayout& layout)
+    {
+        const uint64_t alignedMemory = iox::cxx::align(addressOf(m_memory), MAX_PAYLOAD_ALIGNMENT);
+        return new (reinterpret_cast<void*>(alignedMemory + offset)) ChunkHeader(layout);
+    }
+
+    uint64_t addressOf(const void* const pointer)
+    {
+        return reinterpret_cast<uint64_t>(pointer);
+    }
+
+    static constexpr uint64_t MAX_PAYLOAD_ALIGNMENT{4096u};
+    static constexpr uint64_t MEMORY_SIZE{4u * MAX_PAYLOAD_ALIGNMENT};
+    alignas(ChunkHeader) uint8_t m_memory[MEMORY_SIZE];
+};
+
+TEST_F(ChunkHeader_test, ChunkHeaderHasSizeOf64Bytes)
+{
+    EXPECT_THAT(sizeof(ChunkHeader), Eq(64u));
+}
+
+TEST_F(ChunkHeader_test, DefaultLayoutPlacesPayloadRightBehindChunkHeader)
+{
+    auto sut = new (m_memory) ChunkHeader();
+
+    EXPECT_THAT(sut->m_payloadOffset, Eq(sizeof(ChunkHeader)));
+    EXPECT_THAT(addressOf(sut->payload()), Eq(addressOf(sut) + sizeof(ChunkHeader)));
+    EXPECT_THAT(sut->userHeader(), Eq(nullptr));
+    EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(sut->payload()), Eq(sut));
+    EXPECT_THAT(ChunkHeader::requiredChunkSize(100u, ChunkLayout()), Eq(sizeof(ChunkHeader) + 100u));
+}
+
+TEST_F(ChunkHeader_test, PayloadWithLargeAlignmentIsAlignedAndFitsIntoRequiredChunkSize)
+{
+    constexpr uint32_t PayloadSize{128u};
+    for (uint32_t payloadAlignment = 1u; payloadAlignment <= MAX_PAYLOAD_ALIGNMENT; payloadAlignment *= 2u)
+    {
+        const ChunkLayout layout{payloadAlignment, 0u};
+        for (uint64_t offset = 0u; offset < payloadAlignment; offset += alignof(ChunkHeader))
+        {
+            auto sut = createChunkHeader(offset, layout);
+
+            EXPECT_THAT(addressOf(sut->payload()) % payloadAlignment, Eq(0u));
+            EXPECT_THAT(addressOf(sut->payload()), Ge(addressOf(sut) + sizeof(ChunkHeader)));
+            EXPECT_THAT(sut->m_payloadOffset + PayloadSize, Le(ChunkHeader::requiredChunkSize(PayloadSize, layout)));
+            EXPECT_THAT(sut->userHeader(), Eq(nullptr));
+            EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(sut->payload()), Eq(sut));
+        }
+    }
+}
+
+TEST_F(ChunkHeader_test, UserHeaderIsPlacedBetweenChunkHeaderAndPayload)
+{
+    constexpr uint32_t PayloadSize{128u};
+    constexpr uint32_t UserHeaderSize{40u};
+    for (uint32_t payloadAlignment = 1u; payloadAlignment <= MAX_PAYLOAD_ALIGNMENT; payloadAlignment *= 2u)
+    {
+        const ChunkLayout layout{payloadAlignment, UserHeaderSize};
+        for (uint64_t offset = 0u; offset < payloadAlignment; offset += alignof(ChunkHeader))
+        {
+            auto sut = createChunkHeader(offset, layout);
+
+            EXPECT_THAT(addressOf(sut->userHeader()), Eq(addressOf(sut) + sizeof(ChunkHeader)));
+            EXPECT_THAT(addressOf(sut->payload()) % payloadAlignment, Eq(0u));
+            EXPECT_THAT(addressOf(sut->payload()),
+                        Ge(addressOf(sut->userHeader()) + UserHeaderSize + sizeof(ChunkHeader::PayloadOffset_t)));
+            EXPECT_THAT(sut->m_payloadOffset + PayloadSize, Le(ChunkHeader::requiredChunkSize(PayloadSize, layout)));
+            EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(sut->payload()), Eq(sut));
+        }
+    }
+}
+
+TEST_F(ChunkHeader_test, RequiredChunkSizeOfHugePayloadExceedsRangeOfUint32)
+{
+    const ChunkLayout layout{MAX_PAYLOAD_ALIGNMENT, 0u};
+    EXPECT_THAT(ChunkHeader::requiredChunkSize(std::numeric_limits<uint32_t>::max(), layout),
+                Gt(static_cast<uint64_t>(std::numeric_limits<uint32_t>::max())));
+}
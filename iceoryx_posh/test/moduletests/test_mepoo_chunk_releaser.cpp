@@ -0,0 +1,124 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/mepoo/chunk_releaser.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+using namespace ::testing;
+
+using iox::mepoo::ChunkReleaser;
+using iox::mepoo::MemPool;
+using iox::mepoo::SharedChunk;
+
+class ChunkReleaser_test : public Test
+{
+  public:
+    ChunkReleaser_test()
+    {
+        m_mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+        m_memoryManager.configureMemoryManager(m_mempoolconf, &m_memoryAllocator, &m_memoryAllocator);
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 2 * MemPool::MAX_CHUNKS_PER_BATCH;
+    static constexpr uint32_t SMALL_CHUNK = 128;
+    static constexpr uint32_t BIG_CHUNK = 256;
+    static constexpr size_t MEMORY_SIZE = 1024 * 1024;
+    uint8_t m_memory[MEMORY_SIZE];
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MePooConfig m_mempoolconf;
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    ChunkReleaser m_sut;
+};
+
+TEST_F(ChunkReleaser_test, ReleasedChunkIsFreedWithFlush)
+{
+    m_sut.release(m_memoryManager.getChunk(SMALL_CHUNK));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+
+    m_sut.flush();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkReleaser_test, ReleasedChunkIsFreedWhenReleaserGoesOutOfScope)
+{
+    {
+        ChunkReleaser sut;
+        sut.release(m_memoryManager.getChunk(SMALL_CHUNK));
+        EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkReleaser_test, ReleasedChunkWithOtherOwnerIsNotFreed)
+{
+    auto chunk = m_memoryManager.getChunk(SMALL_CHUNK);
+    m_sut.release(SharedChunk(chunk));
+    m_sut.flush();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    EXPECT_TRUE(chunk.hasNoOtherOwners());
+
+    chunk = nullptr;
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkReleaser_test, ReleaseOfEmptySharedChunkIsIgnored)
+{
+    m_sut.release(SharedChunk());
+    m_sut.flush();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkReleaser_test, ReleasedChunksFromDifferentMemPoolsAreFreed)
+{
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        m_sut.release(m_memoryManager.getChunk((i % 2 == 0) ? SMALL_CHUNK : BIG_CHUNK));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(5u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(5u));
+
+    m_sut.flush();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0u));
+
+    // the freed chunks can be acquired again
+    std::vector<SharedChunk> chunks;
+    for (uint32_t i = 0; i < NUM_CHUNKS_IN_POOL; ++i)
+    {
+        chunks.push_back(m_memoryManager.getChunk(SMALL_CHUNK));
+        EXPECT_TRUE(chunks.back());
+    }
+}
+
+TEST_F(ChunkReleaser_test, ChunksAreFlushedWhenBatchIsFull)
+{
+    for (uint32_t i = 0; i < MemPool::MAX_CHUNKS_PER_BATCH + 1u; ++i)
+    {
+        m_sut.release(m_memoryManager.getChunk(SMALL_CHUNK));
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+}
@@ -14,6 +14,8 @@
 
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
@@ -78,6 +80,75 @@ TEST_F(MemoryManager_test, getChunkSizeForWrongSampleSize)
     EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(129), Eq(0u));
 }
 
+TEST_F(MemoryManager_test, getMempoolChunkSizeForPayloadSizeWithMultipleMemPoolsInSameSizeClass)
+{
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({160, 10});
+    mempoolconf.addMemPool({192, 10});
+    mempoolconf.addMemPool({224, 10});
+    mempoolconf.addMemPool({4096, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(1), Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(32), Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(33), Eq(adjustedChunkSize(160u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(160), Eq(adjustedChunkSize(160u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(161), Eq(adjustedChunkSize(192u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(193), Eq(adjustedChunkSize(224u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(225), Eq(adjustedChunkSize(4096u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(4096), Eq(adjustedChunkSize(4096u)));
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(4097), Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkUsesSmallestFittingMemPoolForAllPayloadSizes)
+{
+    constexpr uint32_t NumberOfMemPools{8};
+    for (uint32_t i = 1; i <= NumberOfMemPools; ++i)
+    {
+        mempoolconf.addMemPool({i * i * 32, 2});
+    }
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    const uint32_t maxPayloadSize = NumberOfMemPools * NumberOfMemPools * 32;
+    for (uint32_t payloadSize = 1; payloadSize <= maxPayloadSize; ++payloadSize)
+    {
+        uint32_t expectedIndex = 0;
+        while (sut->getMemPoolInfo(expectedIndex).m_chunkSize < adjustedChunkSize(payloadSize))
+        {
+            ++expectedIndex;
+        }
+
+        auto chunk = sut->getChunk(payloadSize);
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_totalSizeOfChunk,
+                    Eq(sut->getMemPoolInfo(expectedIndex).m_chunkSize));
+    }
+}
+
+TEST_F(MemoryManager_test, getMempoolChunkSizeForPayloadSizeWithMaxNumberOfMemPoolsInSameSizeClass)
+{
+    // all mempools have a chunk size between 4097 and 8192 and are in the same size class
+    for (uint32_t i = 0; i < iox::MAX_NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({4096 + i * 32, 1});
+    }
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    const uint32_t maxPayloadSize = 4096 + (iox::MAX_NUMBER_OF_MEMPOOLS - 1) * 32;
+    for (uint32_t payloadSize = 1; payloadSize <= maxPayloadSize; ++payloadSize)
+    {
+        uint32_t expectedIndex = 0;
+        while (sut->getMemPoolInfo(expectedIndex).m_chunkSize < adjustedChunkSize(payloadSize))
+        {
+            ++expectedIndex;
+        }
+
+        ASSERT_THAT(sut->getMempoolChunkSizeForPayloadSize(payloadSize),
+                    Eq(sut->getMemPoolInfo(expectedIndex).m_chunkSize));
+    }
+    EXPECT_THAT(sut->getMempoolChunkSizeForPayloadSize(maxPayloadSize + 1), Eq(0u));
+}
+
 TEST_F(MemoryManager_test, wrongcallConfigureMemoryManager)
 {
     mempoolconf.addMemPool({32, 10});
@@ -316,6 +387,236 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(ChunkCount));
 }
 
+TEST_F(MemoryManager_test, getChunkFromExhaustedMemPoolWithoutSpillOverFails)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getChunk(32), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(0u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkFromExhaustedMemPoolWithSpillOverUsesNextLargerMemPool)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.addMemPool({128, ChunkCount});
+    mempoolconf.setSpillOverMemPools(1);
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    // a successful spill over is not reported as an exhausted mempool
+    testing::internal::CaptureStderr();
+    chunkStore.push_back(sut->getChunk(32));
+    EXPECT_THAT(testing::internal::GetCapturedStderr(), Eq(""));
+    ASSERT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->m_info.m_payloadSize, Eq(32u));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(1u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(0u));
+
+    chunkStore.pop_back();
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillOverIsLimitedToConfiguredNumberOfMemPools)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.addMemPool({128, ChunkCount});
+    mempoolconf.setSpillOverMemPools(1);
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < 2 * ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    testing::internal::CaptureStderr();
+    EXPECT_THAT(sut->getChunk(32), Eq(false));
+    EXPECT_THAT(testing::internal::GetCapturedStderr(), HasSubstr("has no more space left"));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkWithSpillOverFromLargestMemPoolFails)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.setSpillOverMemPools(5);
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < ChunkCount; i++)
+    {
+        chunkStore.push_back(sut->getChunk(64));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getChunk(64), Eq(false));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunksAcquiresRequestedNumberOfChunksFromBestFittingMemPool)
+{
+    constexpr uint32_t ChunkCount{50};
+    constexpr uint32_t BatchSize{40};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::SharedChunk chunks[BatchSize];
+    EXPECT_THAT(sut->getChunks(20, chunks, BatchSize), Eq(BatchSize));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(BatchSize));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+    for (auto& chunk : chunks)
+    {
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_payloadSize, Eq(20u));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_usedSizeOfChunk, Eq(adjustedChunkSize(20u)));
+        EXPECT_THAT(chunk.getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(32u)));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunksFromAlmostExhaustedMemPoolWithoutSpillOverAcquiresRemainingChunks)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(32);
+    iox::mepoo::SharedChunk chunks[ChunkCount];
+    EXPECT_THAT(sut->getChunks(32, chunks, ChunkCount), Eq(ChunkCount - 1u));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(0u));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0u));
+    EXPECT_THAT(chunks[ChunkCount - 1u], Eq(false));
+}
+
+TEST_F(MemoryManager_test, getChunksFromAlmostExhaustedMemPoolWithSpillOverUsesNextLargerMemPool)
+{
+    constexpr uint32_t ChunkCount{10};
+
+    mempoolconf.addMemPool({32, ChunkCount});
+    mempoolconf.addMemPool({64, ChunkCount});
+    mempoolconf.addMemPool({128, ChunkCount});
+    mempoolconf.setSpillOverMemPools(1);
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(32);
+    iox::mepoo::SharedChunk chunks[2 * ChunkCount];
+    EXPECT_THAT(sut->getChunks(32, chunks, 2 * ChunkCount), Eq(2 * ChunkCount - 1u));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(ChunkCount));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(0u));
+    EXPECT_THAT(chunks[ChunkCount - 2u].getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(32u)));
+    EXPECT_THAT(chunks[ChunkCount - 1u].getChunkHeader()->m_info.m_totalSizeOfChunk, Eq(adjustedChunkSize(64u)));
+    EXPECT_THAT(chunks[ChunkCount - 1u].getChunkHeader()->m_info.m_payloadSize, Eq(32u));
+    EXPECT_THAT(chunks[2 * ChunkCount - 1u], Eq(false));
+}
+
+TEST_F(MemoryManager_test, getChunksWithTooLargePayloadSizeAcquiresNoChunks)
+{
+    mempoolconf.addMemPool({32, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::mepoo::SharedChunk chunks[2];
+    EXPECT_THAT(sut->getChunks(64, chunks, 2), Eq(0u));
+}
+
+TEST_F(MemoryManager_test, getChunkWithLargePayloadAlignmentPlacesPayloadAtAlignedAddress)
+{
+    constexpr uint32_t PayloadSize{32};
+    constexpr uint32_t PayloadAlignment{256};
+
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({512, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(PayloadSize, {PayloadAlignment, 0u});
+
+    ASSERT_THAT(chunk, Eq(true));
+    auto chunkHeader = chunk.getChunkHeader();
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    EXPECT_THAT(reinterpret_cast<uint64_t>(chunk.getPayload()) % PayloadAlignment, Eq(0u));
+    EXPECT_THAT(chunkHeader->m_payloadAlignment, Eq(PayloadAlignment));
+    EXPECT_THAT(chunkHeader->m_info.m_usedSizeOfChunk, Eq(chunkHeader->m_payloadOffset + PayloadSize));
+    EXPECT_THAT(chunkHeader->m_info.m_usedSizeOfChunk, Le(chunkHeader->m_info.m_totalSizeOfChunk));
+    EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(chunk.getPayload()), Eq(chunkHeader));
+}
+
+TEST_F(MemoryManager_test, getChunkWithUserHeaderPlacesUserHeaderInFrontOfPayload)
+{
+    constexpr uint32_t PayloadSize{16};
+    constexpr uint32_t UserHeaderSize{24};
+
+    mempoolconf.addMemPool({32, 10});
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    auto chunk = sut->getChunk(PayloadSize, {iox::mepoo::ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT, UserHeaderSize});
+
+    ASSERT_THAT(chunk, Eq(true));
+    auto chunkHeader = chunk.getChunkHeader();
+    auto userHeader = reinterpret_cast<uint64_t>(chunkHeader->userHeader());
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    EXPECT_THAT(userHeader, Eq(reinterpret_cast<uint64_t>(chunkHeader) + sizeof(iox::mepoo::ChunkHeader)));
+    EXPECT_THAT(reinterpret_cast<uint64_t>(chunk.getPayload()), Ge(userHeader + UserHeaderSize));
+    EXPECT_THAT(chunkHeader->m_info.m_usedSizeOfChunk, Le(chunkHeader->m_info.m_totalSizeOfChunk));
+    EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(chunk.getPayload()), Eq(chunkHeader));
+}
+
+TEST_F(MemoryManager_test, getChunkWithPayloadAlignmentWhichIsNoPowerOfTwoCallsErrorHandler)
+{
+    mempoolconf.addMemPool({128, 10});
+    sut->configureMemoryManager(mempoolconf, allocator, allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    EXPECT_THAT(sut->getChunk(32, {48u, 0u}), Eq(false));
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_INVALID_PAYLOAD_ALIGNMENT));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
 TEST_F(MemoryManager_test, getChunkWithSizeZeroShouldFail)
 {
     EXPECT_DEATH({ sut->getChunk(0); }, ".*");
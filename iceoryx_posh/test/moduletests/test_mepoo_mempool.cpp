@@ -13,9 +13,15 @@
 // limitations under the License.
 
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_utils/cxx/optional.hpp"
+#include "iceoryx_utils/error_handling/error_handling.hpp"
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <atomic>
+#include <set>
+#include <thread>
+
 using namespace ::testing;
 
 class alignas(32) MemPool_test : public Test
@@ -149,6 +155,60 @@ TEST_F(MemPool_test, freeChunkAndGetChunkFull)
     }
 }
 
+TEST_F(MemPool_test, getChunksAcquiresDistinctChunks)
+{
+    constexpr uint32_t BatchSize{NumberOfChunks / 2};
+    void* chunks[BatchSize];
+
+    EXPECT_THAT(sut.getChunks(chunks, BatchSize), Eq(BatchSize));
+
+    std::set<void*> distinctChunks(chunks, chunks + BatchSize);
+    EXPECT_THAT(distinctChunks.size(), Eq(BatchSize));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(BatchSize));
+    EXPECT_THAT(sut.getMinFree(), Eq(NumberOfChunks - BatchSize));
+}
+
+TEST_F(MemPool_test, getChunksWhenAlmostFullAcquiresRemainingChunks)
+{
+    void* chunks[NumberOfChunks];
+    EXPECT_THAT(sut.getChunks(chunks, NumberOfChunks - 10), Eq(NumberOfChunks - 10));
+
+    EXPECT_THAT(sut.getChunks(chunks, 20), Eq(10u));
+    EXPECT_THAT(sut.getChunks(chunks, 20), Eq(0u));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NumberOfChunks));
+}
+
+TEST_F(MemPool_test, freeChunksHandsBackAllChunks)
+{
+    void* chunks[NumberOfChunks];
+    ASSERT_THAT(sut.getChunks(chunks, NumberOfChunks), Eq(NumberOfChunks));
+
+    sut.freeChunks(chunks, NumberOfChunks);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0u));
+    EXPECT_THAT(sut.getChunks(chunks, NumberOfChunks), Eq(NumberOfChunks));
+}
+
+TEST_F(MemPool_test, freeChunksWithChunkFreedTwiceCallsErrorHandlerAndFreesValidChunks)
+{
+    void* chunks[3];
+    ASSERT_THAT(sut.getChunks(chunks, 2), Eq(2u));
+    chunks[2] = chunks[0];
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    sut.freeChunks(chunks, 3);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+    void* allChunks[NumberOfChunks];
+    EXPECT_THAT(sut.getChunks(allChunks, NumberOfChunks), Eq(NumberOfChunks));
+}
+
 TEST_F(MemPool_test, getMinFreeSimpleGetChunk)
 {
     std::vector<uint8_t*> chunks;
@@ -203,6 +263,71 @@ TEST_F(MemPool_test, getMinFreeWithSecondGetChunk)
     }
 }
 
+TEST_F(MemPool_test, getMinFreeWhenExhausted)
+{
+    void* chunks[NumberOfChunks];
+    ASSERT_THAT(sut.getChunks(chunks, NumberOfChunks - 1), Eq(NumberOfChunks - 1));
+    EXPECT_THAT(sut.getMinFree(), Eq(1u));
+
+    EXPECT_THAT(sut.getChunks(chunks + NumberOfChunks - 1, 2), Eq(1u));
+    EXPECT_THAT(sut.getChunk(), Eq(nullptr));
+
+    EXPECT_THAT(sut.getMinFree(), Eq(0u));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NumberOfChunks));
+
+    sut.freeChunks(chunks, NumberOfChunks);
+    EXPECT_THAT(sut.getMinFree(), Eq(0u));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0u));
+}
+
+TEST_F(MemPool_test, getMinFreeWithConcurrentGetChunkIsLowestNumberOfFreeChunks)
+{
+    constexpr uint32_t NumberOfThreads{4};
+    constexpr uint32_t ChunksPerThread{NumberOfChunks / NumberOfThreads - 1};
+    constexpr uint32_t NumberOfRounds{1000};
+
+    std::atomic<uint32_t> threadsHoldingChunks{0};
+    std::atomic<uint32_t> round{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < NumberOfThreads; ++t)
+    {
+        threads.emplace_back([&] {
+            std::vector<void*> chunks;
+            for (uint32_t r = 0; r < NumberOfRounds; ++r)
+            {
+                for (uint32_t i = 0; i < ChunksPerThread; ++i)
+                {
+                    chunks.push_back(sut.getChunk());
+                }
+
+                // wait until all threads hold their chunks, then the lowest number of free chunks is reached
+                if (threadsHoldingChunks.fetch_add(1) + 1 == NumberOfThreads * (r + 1))
+                {
+                    round.store(r + 1);
+                }
+                while (round.load() <= r)
+                {
+                    std::this_thread::yield();
+                }
+
+                for (auto chunk : chunks)
+                {
+                    sut.freeChunk(chunk);
+                }
+                chunks.clear();
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(sut.getMinFree(), Eq(NumberOfChunks - NumberOfThreads * ChunksPerThread));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0u));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, &allocator, &allocator); }, ".*");
@@ -18,6 +18,8 @@
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 using namespace ::testing;
 
 using namespace iox::mepoo;
@@ -194,6 +196,46 @@ TEST_F(SharedChunk_Test, getPayloadWhenValid)
     EXPECT_THAT(*static_cast<int*>(sut2.getPayload()), Eq(1337));
 }
 
+TEST_F(SharedChunk_Test, shareWithHandsOutOwnersOfTheChunk)
+{
+    constexpr uint64_t NumberOfOwners{5};
+    std::vector<SharedChunk> owners;
+
+    sut.shareWith(NumberOfOwners, [&](SharedChunk&& owner) { owners.emplace_back(std::move(owner)); });
+
+    ASSERT_THAT(owners.size(), Eq(NumberOfOwners));
+    for (auto& owner : owners)
+    {
+        EXPECT_THAT(owner, Eq(sut));
+    }
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(NumberOfOwners + 1));
+}
+
+TEST_F(SharedChunk_Test, shareWithFreesChunkWhenAllOwnersAreGone)
+{
+    std::vector<SharedChunk> owners;
+    sut.shareWith(3, [&](SharedChunk&& owner) { owners.emplace_back(std::move(owner)); });
+
+    sut = nullptr;
+    owners.pop_back();
+    owners.pop_back();
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(1));
+
+    owners.pop_back();
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(0));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(0));
+}
+
+TEST_F(SharedChunk_Test, shareWithOfEmptyChunkHandsOutNoOwners)
+{
+    SharedChunk emptyChunk;
+    uint64_t numberOfOwners{0};
+
+    emptyChunk.shareWith(3, [&](SharedChunk&&) { ++numberOfOwners; });
+
+    EXPECT_THAT(numberOfOwners, Eq(0u));
+}
+
 TEST_F(SharedChunk_Test, MultipleSharedChunksCleanup)
 {
     {
@@ -0,0 +1,294 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/runtime/message_queue_binary_message.hpp"
+#include "test.hpp"
+
+#include <cstring>
+
+using namespace ::testing;
+
+using iox::runtime::MqBinaryMessage;
+
+class MqBinaryMessage_test : public Test
+{
+  protected:
+    /// @brief copies the serialized message of the sender into the receive buffer of the receiver like a message queue
+    bool transmit(const MqBinaryMessage& sender, MqBinaryMessage& receiver, const uint64_t size)
+    {
+        std::memcpy(receiver.getReceiveBuffer(), sender.getData(), size);
+        return receiver.setReceivedSize(size);
+    }
+
+    MqBinaryMessage sut;
+};
+
+TEST_F(MqBinaryMessage_test, DefaultCTorCreatesEmptyValidMessage)
+{
+    EXPECT_THAT(sut.isValid(), Eq(true));
+    EXPECT_THAT(sut.getNumberOfFields(), Eq(0u));
+    EXPECT_THAT(MqBinaryMessage::isBinaryMessage(sut.getData(), sut.getSize()), Eq(true));
+}
+
+TEST_F(MqBinaryMessage_test, ReadFromEmptyMessageFails)
+{
+    uint64_t value{0u};
+    EXPECT_THAT(sut.readUnsigned(value), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, FieldsCanBeReadInTheOrderTheyWereAdded)
+{
+    sut.addSigned(-73).addUnsigned(1234567890123u).addString(iox::cxx::string<20>("hypnotoad"));
+
+    EXPECT_THAT(sut.getNumberOfFields(), Eq(3u));
+
+    int64_t signedValue{0};
+    uint64_t unsignedValue{0u};
+    iox::cxx::string<20> stringValue;
+    ASSERT_THAT(sut.readSigned(signedValue), Eq(true));
+    ASSERT_THAT(sut.readUnsigned(unsignedValue), Eq(true));
+    ASSERT_THAT(sut.readString(stringValue), Eq(true));
+    EXPECT_THAT(signedValue, Eq(-73));
+    EXPECT_THAT(unsignedValue, Eq(1234567890123u));
+    EXPECT_THAT(stringValue, Eq(iox::cxx::string<20>("hypnotoad")));
+    EXPECT_THAT(sut.readUnsigned(unsignedValue), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, StringWithSeparatorsAndNullCharactersCanBeTransmitted)
+{
+    const char data[] = {'a', ',', '\0', 'b'};
+    sut.addString(data, sizeof(data));
+
+    iox::cxx::string<10> stringValue;
+    ASSERT_THAT(sut.readString(stringValue), Eq(true));
+    ASSERT_THAT(stringValue.size(), Eq(sizeof(data)));
+    EXPECT_THAT(std::memcmp(stringValue.c_str(), data, sizeof(data)), Eq(0));
+}
+
+TEST_F(MqBinaryMessage_test, ReadWithWrongTypeFailsAndKeepsReadPosition)
+{
+    sut.addUnsigned(42u);
+
+    int64_t signedValue{0};
+    iox::cxx::string<10> stringValue;
+    EXPECT_THAT(sut.readSigned(signedValue), Eq(false));
+    EXPECT_THAT(sut.readString(stringValue), Eq(false));
+
+    uint64_t unsignedValue{0u};
+    ASSERT_THAT(sut.readUnsigned(unsignedValue), Eq(true));
+    EXPECT_THAT(unsignedValue, Eq(42u));
+}
+
+TEST_F(MqBinaryMessage_test, ReadStringWhichDoesNotFitFailsAndKeepsReadPosition)
+{
+    sut.addString(iox::cxx::string<20>("too long for target"));
+
+    iox::cxx::string<5> shortString;
+    EXPECT_THAT(sut.readString(shortString), Eq(false));
+
+    iox::cxx::string<20> longString;
+    ASSERT_THAT(sut.readString(longString), Eq(true));
+    EXPECT_THAT(longString, Eq(iox::cxx::string<20>("too long for target")));
+}
+
+TEST_F(MqBinaryMessage_test, ResetReadPositionRestartsWithFirstField)
+{
+    sut.addUnsigned(1u).addUnsigned(2u);
+
+    uint64_t value{0u};
+    ASSERT_THAT(sut.readUnsigned(value), Eq(true));
+    sut.resetReadPosition();
+    ASSERT_THAT(sut.readUnsigned(value), Eq(true));
+    EXPECT_THAT(value, Eq(1u));
+}
+
+TEST_F(MqBinaryMessage_test, ExceedingTheCapacityInvalidatesTheMessage)
+{
+    while (sut.isValid())
+    {
+        sut.addUnsigned(0u);
+    }
+
+    EXPECT_THAT(sut.getSize(), Le(MqBinaryMessage::CAPACITY));
+
+    uint64_t value{0u};
+    EXPECT_THAT(sut.readUnsigned(value), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, ClearMessageMakesInvalidMessageValidAndEmpty)
+{
+    std::string tooLong(MqBinaryMessage::CAPACITY, 'x');
+    sut.addString(tooLong.c_str(), tooLong.size());
+    ASSERT_THAT(sut.isValid(), Eq(false));
+
+    sut.clearMessage();
+
+    EXPECT_THAT(sut.isValid(), Eq(true));
+    EXPECT_THAT(sut.getNumberOfFields(), Eq(0u));
+}
+
+TEST_F(MqBinaryMessage_test, TransmittedMessageCanBeRead)
+{
+    sut.addSigned(13).addString(iox::cxx::string<10>("fuu"));
+
+    MqBinaryMessage receiver;
+    ASSERT_THAT(transmit(sut, receiver, sut.getSize()), Eq(true));
+    EXPECT_THAT(receiver.getNumberOfFields(), Eq(2u));
+
+    int64_t signedValue{0};
+    iox::cxx::string<10> stringValue;
+    ASSERT_THAT(receiver.readSigned(signedValue), Eq(true));
+    ASSERT_THAT(receiver.readString(stringValue), Eq(true));
+    EXPECT_THAT(signedValue, Eq(13));
+    EXPECT_THAT(stringValue, Eq(iox::cxx::string<10>("fuu")));
+}
+
+TEST_F(MqBinaryMessage_test, ReceivedMessageWithWrongSizeIsInvalid)
+{
+    sut.addUnsigned(1u).addUnsigned(2u);
+
+    MqBinaryMessage receiver;
+    EXPECT_THAT(transmit(sut, receiver, sut.getSize() - 1u), Eq(false));
+    EXPECT_THAT(receiver.isValid(), Eq(false));
+    EXPECT_THAT(receiver.setReceivedSize(0u), Eq(false));
+    EXPECT_THAT(receiver.setReceivedSize(MqBinaryMessage::CAPACITY + 1u), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, ReceivedTextMessageIsInvalid)
+{
+    MqBinaryMessage receiver;
+    const char textMessage[] = "REG,app,12,0,123,";
+    std::memcpy(receiver.getReceiveBuffer(), textMessage, sizeof(textMessage));
+
+    EXPECT_THAT(MqBinaryMessage::isBinaryMessage(textMessage, sizeof(textMessage)), Eq(false));
+    EXPECT_THAT(receiver.setReceivedSize(sizeof(textMessage)), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, ReceivedMessageWithUnsupportedVersionIsInvalid)
+{
+    sut.addUnsigned(1u);
+
+    MqBinaryMessage receiver;
+    std::memcpy(receiver.getReceiveBuffer(), sut.getData(), sut.getSize());
+    static_cast<uint8_t*>(receiver.getReceiveBuffer())[1] = MqBinaryMessage::VERSION + 1u;
+
+    EXPECT_THAT(receiver.setReceivedSize(sut.getSize()), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, ServiceDescriptionRoundTrip)
+{
+    iox::capro::ServiceDescription service(
+        "Radar", "FrontLeft", "Objects", {1u, 2u, 3u, 4u}, iox::capro::Interfaces::SOMEIP);
+    service.setInternal();
+    sut.addServiceDescription(service);
+
+    iox::capro::ServiceDescription result;
+    ASSERT_THAT(sut.readServiceDescription(result), Eq(true));
+    EXPECT_THAT(result, Eq(service));
+    EXPECT_THAT(result.getClassHash() == service.getClassHash(), Eq(true));
+    EXPECT_THAT(result.getSourceInterface(), Eq(iox::capro::Interfaces::SOMEIP));
+    EXPECT_THAT(result.getScope(), Eq(iox::capro::Scope::INTERNAL));
+    EXPECT_THAT(result.hasServiceOnlyDescription(), Eq(false));
+}
+
+TEST_F(MqBinaryMessage_test, ServiceOnlyDescriptionRoundTrip)
+{
+    iox::capro::ServiceDescription service("Radar", "FrontLeft");
+    sut.addServiceDescription(service);
+
+    iox::capro::ServiceDescription result;
+    ASSERT_THAT(sut.readServiceDescription(result), Eq(true));
+    EXPECT_THAT(result.getServiceIDString(), Eq(service.getServiceIDString()));
+    EXPECT_THAT(result.getInstanceIDString(), Eq(service.getInstanceIDString()));
+    EXPECT_THAT(result.hasServiceOnlyDescription(), Eq(true));
+}
+
+TEST_F(MqBinaryMessage_test, ServiceDescriptionRoundTripKeepsTheSameFieldsAsTheTextProtocol)
+{
+    iox::capro::ServiceDescription service(
+        "Radar", "FrontLeft", "Objects", {5u, 6u, 7u, 8u}, iox::capro::Interfaces::DDS);
+    service.setServiceOnlyDescription();
+    service.setScope(iox::capro::Scope::INVALID);
+    const iox::capro::ServiceDescription textResult{static_cast<iox::cxx::Serialization>(service)};
+    sut.addServiceDescription(service);
+
+    iox::capro::ServiceDescription result;
+    ASSERT_THAT(sut.readServiceDescription(result), Eq(true));
+    EXPECT_THAT(result.getServiceIDString(), Eq(textResult.getServiceIDString()));
+    EXPECT_THAT(result.getInstanceIDString(), Eq(textResult.getInstanceIDString()));
+    EXPECT_THAT(result.getEventIDString(), Eq(textResult.getEventIDString()));
+    EXPECT_THAT(result.getServiceID(), Eq(textResult.getServiceID()));
+    EXPECT_THAT(result.getInstanceID(), Eq(textResult.getInstanceID()));
+    EXPECT_THAT(result.getEventID(), Eq(textResult.getEventID()));
+    EXPECT_THAT(result.getClassHash() == textResult.getClassHash(), Eq(true));
+    EXPECT_THAT(result.getSourceInterface(), Eq(textResult.getSourceInterface()));
+    EXPECT_THAT(result.getScope(), Eq(textResult.getScope()));
+    EXPECT_THAT(result.hasServiceOnlyDescription(), Eq(textResult.hasServiceOnlyDescription()));
+}
+
+TEST_F(MqBinaryMessage_test, ServiceDescriptionWithNumericIdsRoundTrip)
+{
+    iox::capro::ServiceDescription service(1u, 2u, 3u);
+    sut.addServiceDescription(service);
+
+    iox::capro::ServiceDescription result;
+    ASSERT_THAT(sut.readServiceDescription(result), Eq(true));
+    EXPECT_THAT(result.getServiceID(), Eq(1u));
+    EXPECT_THAT(result.getEventID(), Eq(2u));
+    EXPECT_THAT(result.getInstanceID(), Eq(3u));
+    EXPECT_THAT(result.getScope(), Eq(iox::capro::Scope::WORLDWIDE));
+}
+
+TEST_F(MqBinaryMessage_test, ServiceDescriptionWithUnknownScopeAndInterfaceIsClampedLikeTheTextProtocol)
+{
+    sut.addString(iox::cxx::string<10>("Radar"))
+        .addString(iox::cxx::string<10>("FrontLeft"))
+        .addString(iox::cxx::string<10>("Objects"))
+        .addUnsigned(0u)
+        .addUnsigned(0u)
+        .addUnsigned(0u)
+        .addUnsigned(0u)
+        .addUnsigned(1000u)
+        .addUnsigned(1000u)
+        .addUnsigned(0u);
+
+    iox::capro::ServiceDescription result;
+    ASSERT_THAT(sut.readServiceDescription(result), Eq(true));
+    EXPECT_THAT(result.getSourceInterface(), Eq(iox::capro::Interfaces::INTERFACE_END));
+    EXPECT_THAT(result.getScope(), Eq(iox::capro::Scope::INVALID));
+}
+
+TEST_F(MqBinaryMessage_test, ReadIncompleteServiceDescriptionFailsAndKeepsReadPosition)
+{
+    sut.addString(iox::cxx::string<10>("Radar")).addString(iox::cxx::string<10>("FrontLeft"));
+
+    iox::capro::ServiceDescription result;
+    EXPECT_THAT(sut.readServiceDescription(result), Eq(false));
+
+    iox::cxx::string<10> stringValue;
+    ASSERT_THAT(sut.readString(stringValue), Eq(true));
+    EXPECT_THAT(stringValue, Eq(iox::cxx::string<10>("Radar")));
+}
+
+TEST_F(MqBinaryMessage_test, PortConfigInfoRoundTrip)
+{
+    iox::runtime::PortConfigInfo portConfigInfo(1u, 2u, 3u);
+    sut.addPortConfigInfo(portConfigInfo);
+
+    iox::runtime::PortConfigInfo result;
+    ASSERT_THAT(sut.readPortConfigInfo(result), Eq(true));
+    EXPECT_THAT(result.portType, Eq(1u));
+    EXPECT_THAT(result.memoryInfo.deviceId, Eq(2u));
+    EXPECT_THAT(result.memoryInfo.memoryType, Eq(3u));
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+
+#include "test.hpp"
+
+using namespace ::testing;
+using namespace iox::popo;
+
+class ApplicationPort_test : public Test
+{
+  public:
+    void SetUp(){};
+    void TearDown(){};
+
+    ApplicationPortData m_applicationPortData{"/application"};
+    ApplicationPort m_sutApplicationSide{&m_applicationPortData};
+    ApplicationPort m_sutRouDiSide{&m_applicationPortData};
+};
+
+TEST_F(ApplicationPort_test, InitialKeepAliveCounterIsZero)
+{
+    EXPECT_THAT(m_sutRouDiSide.getKeepAliveCounter(), Eq(0u));
+}
+
+TEST_F(ApplicationPort_test, SendKeepAliveIncrementsKeepAliveCounter)
+{
+    m_sutApplicationSide.sendKeepAlive();
+    m_sutApplicationSide.sendKeepAlive();
+
+    EXPECT_THAT(m_sutRouDiSide.getKeepAliveCounter(), Eq(2u));
+}
+
+TEST_F(ApplicationPort_test, SendKeepAliveDoesNotProvideCaProMessage)
+{
+    m_sutApplicationSide.sendKeepAlive();
+
+    EXPECT_FALSE(m_sutRouDiSide.tryGetCaProMessage().has_value());
+}
+
+TEST_F(ApplicationPort_test, DispatchedCaProMessageIsProvidedToRouDi)
+{
+    iox::capro::CaproMessage message(iox::capro::CaproMessageType::OFFER, {1u, 1u, 1u});
+    m_sutApplicationSide.dispatchCaProMessage(message);
+
+    auto maybeMessage = m_sutRouDiSide.tryGetCaProMessage();
+
+    ASSERT_TRUE(maybeMessage.has_value());
+    EXPECT_THAT(maybeMessage.value().m_type, Eq(iox::capro::CaproMessageType::OFFER));
+    EXPECT_THAT(maybeMessage.value().m_serviceDescription, Eq(iox::capro::ServiceDescription(1u, 1u, 1u)));
+}
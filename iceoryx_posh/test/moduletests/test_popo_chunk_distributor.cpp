@@ -23,7 +23,13 @@
 #include "iceoryx_utils/cxx/variant_queue.hpp"
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
 
 using namespace ::testing;
 using ::testing::Return;
@@ -350,6 +356,34 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(limit));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesFreesChunkWhenAllQueuesReleasedIt)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto limit = 10u;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0u; i < limit; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        sut.tryAddQueue(queueData.back().get());
+    }
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(42));
+    sut.clearHistory();
+
+    for (auto i = 0u; i < limit; ++i)
+    {
+        EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1u));
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(42u));
+    }
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0u));
+    EXPECT_THAT(this->chunkMgmtPool.getUsedChunks(), Eq(0u));
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     auto sutData = this->getChunkDistributorData();
@@ -531,3 +565,268 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithMoreThanAvailable)
     ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
+
+TYPED_TEST(ChunkDistributor_test, CleanupWithoutHistoryDoesNotRequireTheLock)
+{
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(0u);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandler::SetTemporaryErrorHandler(
+        [&errorHandlerCalled](const iox::Error, const std::function<void()>, const iox::ErrorLevel) {
+            errorHandlerCalled = true;
+        });
+
+    // simulates an application which was terminated while holding the lock
+    std::atomic_bool isLocked{false};
+    std::atomic_bool isCleanedUp{false};
+    std::thread lockHolder([&] {
+        sutData->lock();
+        isLocked = true;
+        while (!isCleanedUp)
+        {
+            std::this_thread::yield();
+        }
+        sutData->unlock();
+    });
+    while (!isLocked)
+    {
+        std::this_thread::yield();
+    }
+
+    sut.cleanup();
+    isCleanedUp = true;
+    lockHolder.join();
+
+    EXPECT_FALSE(errorHandlerCalled);
+}
+
+TYPED_TEST(ChunkDistributor_test, MultiThreadedDeliveryWithConcurrentAddAndRemoveOfQueues)
+{
+    constexpr uint32_t NUMBER_OF_DELIVERIES{10000u};
+    constexpr uint32_t NUMBER_OF_CHANGING_QUEUES{4u};
+    constexpr uint64_t CHANGING_QUEUE_CAPACITY{2u};
+
+    // without history the delivery is lock-free and also the SingleThreadedPolicy is sufficient for a single
+    // thread adding and removing queues
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(0u);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto permanentQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> permanentQueue(permanentQueueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(permanentQueueData.get()).has_error());
+
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> changingQueueData;
+    for (uint32_t i = 0u; i < NUMBER_OF_CHANGING_QUEUES; ++i)
+    {
+        changingQueueData.emplace_back(this->getChunkQueueData());
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t>(changingQueueData.back().get())
+            .setCapacity(CHANGING_QUEUE_CAPACITY);
+    }
+
+    std::atomic_bool isDeliveryFinished{false};
+    std::atomic<uint64_t> deliveriesToRemovedQueues{0u};
+    std::thread queueChanger([&] {
+        uint64_t index{0u};
+        while (!isDeliveryFinished)
+        {
+            auto queueData = changingQueueData[index % NUMBER_OF_CHANGING_QUEUES].get();
+            ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData);
+            if (index % (2u * NUMBER_OF_CHANGING_QUEUES) < NUMBER_OF_CHANGING_QUEUES)
+            {
+                // nothing must be delivered to a queue between its removal and adding it again
+                if (!queue.empty())
+                {
+                    ++deliveriesToRemovedQueues;
+                }
+                sut.tryAddQueue(queueData);
+            }
+            else
+            {
+                sut.tryRemoveQueue(queueData);
+                queue.clear();
+            }
+            ++index;
+        }
+    });
+
+    for (uint32_t i = 0u; i < NUMBER_OF_DELIVERIES; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+
+        auto maybeSharedChunk = permanentQueue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    isDeliveryFinished = true;
+    queueChanger.join();
+
+    EXPECT_THAT(deliveriesToRemovedQueues.load(), Eq(0u));
+    EXPECT_TRUE(permanentQueue.empty());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWaitsForOngoingDeliveryOfAliveSender)
+{
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(0u);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // simulates a sender of this process which is in the middle of a delivery
+    const uint64_t epochIndex = sutData->m_deliveryEpoch % 2u;
+    sutData->m_senderPid = getpid();
+    sutData->m_ongoingDeliveries[epochIndex]++;
+
+    std::atomic_bool isDeliveryFinished{false};
+    std::atomic_bool isRemovalStarted{false};
+    std::thread sender([&] {
+        while (!isRemovalStarted)
+        {
+            std::this_thread::yield();
+        }
+        // exceed the liveness check interval to ensure that an alive sender is not treated as terminated
+        std::this_thread::sleep_for(std::chrono::milliseconds(
+            2u * iox::CHUNK_DISTRIBUTOR_SENDER_LIVENESS_CHECK_INTERVAL.milliSeconds<uint64_t>()));
+        isDeliveryFinished = true;
+        sutData->m_ongoingDeliveries[epochIndex]--;
+    });
+
+    isRemovalStarted = true;
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_TRUE(isDeliveryFinished);
+    sender.join();
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueDoesNotWaitForeverForTerminatedSender)
+{
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(0u);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // simulates a sender which was terminated in the middle of a delivery
+    auto terminatedSenderPid = fork();
+    ASSERT_THAT(terminatedSenderPid, Ne(-1));
+    if (terminatedSenderPid == 0)
+    {
+        _exit(0);
+    }
+    ASSERT_THAT(waitpid(terminatedSenderPid, nullptr, 0), Eq(terminatedSenderPid));
+    sutData->m_senderPid = terminatedSenderPid;
+    sutData->m_ongoingDeliveries[sutData->m_deliveryEpoch % 2u]++;
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    // the stale registration was reset, delivering and removing work again
+    EXPECT_THAT(sutData->m_ongoingDeliveries[0u].load(), Eq(0u));
+    EXPECT_THAT(sutData->m_ongoingDeliveries[1u].load(), Eq(0u));
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(42u));
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sutData->m_senderPid.load(), Eq(getpid()));
+}
+
+TYPED_TEST(ChunkDistributor_test, ConcurrentDeliveriesFromMultipleSendersToRemovedQueue)
+{
+    constexpr uint32_t NUMBER_OF_SENDERS{4u};
+    constexpr uint32_t NUMBER_OF_DELIVERIES{2000u};
+
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(0u);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(2u);
+
+    std::atomic_bool isDeliveryFinished{false};
+    std::atomic<uint64_t> deliveriesToRemovedQueue{0u};
+    std::thread queueChanger([&] {
+        while (!isDeliveryFinished)
+        {
+            sut.tryAddQueue(queueData.get());
+            sut.tryRemoveQueue(queueData.get());
+            queue.clear();
+            // with overlapping deliveries of several senders nothing must be delivered after the removal returned
+            if (!queue.empty())
+            {
+                ++deliveriesToRemovedQueue;
+            }
+        }
+    });
+
+    std::vector<std::thread> senders;
+    for (uint32_t i = 0u; i < NUMBER_OF_SENDERS; ++i)
+    {
+        senders.emplace_back([&] {
+            for (uint32_t j = 0u; j < NUMBER_OF_DELIVERIES; ++j)
+            {
+                sut.deliverToAllStoredQueues(this->allocateChunk(j));
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    isDeliveryFinished = true;
+    queueChanger.join();
+
+    EXPECT_THAT(deliveriesToRemovedQueue.load(), Eq(0u));
+    EXPECT_THAT(sutData->m_ongoingDeliveries[0u].load(), Eq(0u));
+    EXPECT_THAT(sutData->m_ongoingDeliveries[1u].load(), Eq(0u));
+}
+
+class ThreadSafeChunkDistributor_test : public ChunkDistributor_test<ThreadSafePolicy>
+{
+};
+
+TEST_F(ThreadSafeChunkDistributor_test, MultiThreadedDeliveryWithHistoryToConcurrentlyAddedQueuesIsInOrder)
+{
+    constexpr uint32_t NUMBER_OF_DELIVERIES{10000u};
+    constexpr uint64_t HISTORY_CAPACITY{2u};
+    constexpr uint64_t QUEUE_CAPACITY{4u};
+
+    auto sutData = std::make_shared<ChunkDistributorData_t>(HISTORY_CAPACITY);
+    ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = getChunkQueueData();
+    ChunkQueuePopper<ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+
+    std::atomic_bool isDeliveryFinished{false};
+    std::atomic<uint64_t> outOfOrderDeliveries{0u};
+    std::thread subscriber([&] {
+        while (!isDeliveryFinished)
+        {
+            sut.tryAddQueue(queueData.get(), HISTORY_CAPACITY);
+
+            // chunks from the history and from the ongoing delivery must be received once and in order
+            int64_t lastValue{-1};
+            for (uint32_t i = 0u; i < 100u; ++i)
+            {
+                auto maybeSharedChunk = queue.tryPop();
+                if (maybeSharedChunk.has_value())
+                {
+                    const int64_t value = getSharedChunkValue(*maybeSharedChunk);
+                    if (value <= lastValue)
+                    {
+                        ++outOfOrderDeliveries;
+                    }
+                    lastValue = value;
+                }
+            }
+
+            sut.tryRemoveQueue(queueData.get());
+            queue.clear();
+        }
+    });
+
+    for (uint32_t i = 0u; i < NUMBER_OF_DELIVERIES; ++i)
+    {
+        sut.deliverToAllStoredQueues(allocateChunk(i));
+    }
+    isDeliveryFinished = true;
+    subscriber.join();
+
+    EXPECT_THAT(outOfOrderDeliveries.load(), Eq(0u));
+}
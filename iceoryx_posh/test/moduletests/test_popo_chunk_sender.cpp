@@ -29,7 +29,9 @@
 #include "iceoryx_utils/internal/posix_wrapper/shared_memory_object/allocator.hpp"
 #include "test.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 using namespace ::testing;
 
@@ -67,6 +69,7 @@ class ChunkSender_test : public Test
     static constexpr uint32_t BIG_CHUNK = 256;
     static constexpr uint64_t HISTORY_CAPACITY = 4;
     static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
+    static constexpr uint32_t MAGAZINE_CAPACITY = 4;
 
     iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0); },
                                           [] { iox::popo::internal::unsetUniqueRouDiId(); }};
@@ -99,6 +102,12 @@ class ChunkSender_test : public Test
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+
+    using ChunkSenderWithMagazineData_t = iox::popo::
+        ChunkSenderData<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t, MAGAZINE_CAPACITY>;
+
+    ChunkSenderWithMagazineData_t m_chunkSenderWithMagazineData{&m_memoryManager, 0};
+    iox::popo::ChunkSender<ChunkSenderWithMagazineData_t> m_chunkSenderWithMagazine{&m_chunkSenderWithMagazineData};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunk)
@@ -530,6 +539,75 @@ TEST_F(ChunkSender_test, ReuseLastIfSmaller)
     EXPECT_TRUE((*chunkSmaller)->payload() == (*maybeLastChunk)->payload());
 }
 
+TEST_F(ChunkSender_test, allocateWithCustomLayoutHasAlignedPayloadAndUserHeader)
+{
+    constexpr uint32_t PAYLOAD_ALIGNMENT{64u};
+    constexpr uint32_t USER_HEADER_SIZE{16u};
+    const iox::mepoo::ChunkLayout layout{PAYLOAD_ALIGNMENT, USER_HEADER_SIZE};
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId(), layout);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = *maybeChunkHeader;
+    EXPECT_THAT(reinterpret_cast<uint64_t>(chunkHeader->payload()) % PAYLOAD_ALIGNMENT, Eq(0u));
+    EXPECT_THAT(chunkHeader->m_payloadAlignment, Eq(PAYLOAD_ALIGNMENT));
+    EXPECT_THAT(chunkHeader->m_userHeaderSize, Eq(USER_HEADER_SIZE));
+    EXPECT_THAT(chunkHeader->userHeader(), Ne(nullptr));
+    EXPECT_THAT(iox::mepoo::convertPayloadPointerToChunkHeader(chunkHeader->payload()), Eq(chunkHeader));
+    EXPECT_THAT(chunkHeader->m_info.m_usedSizeOfChunk, Eq(chunkHeader->m_payloadOffset + sizeof(DummySample)));
+}
+
+TEST_F(ChunkSender_test, ReuseLastWithSameCustomLayout)
+{
+    const iox::mepoo::ChunkLayout layout{64u, 16u};
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId(), layout);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = *maybeChunkHeader;
+    const auto payloadOffset = chunkHeader->m_payloadOffset;
+    m_chunkSender.send(chunkHeader);
+
+    auto maybeNextChunkHeader = m_chunkSender.tryAllocate(2u * sizeof(DummySample), iox::UniquePortId(), layout);
+
+    ASSERT_FALSE(maybeNextChunkHeader.has_error());
+    EXPECT_THAT(*maybeNextChunkHeader, Eq(chunkHeader));
+    EXPECT_THAT((*maybeNextChunkHeader)->m_payloadOffset, Eq(payloadOffset));
+    EXPECT_THAT((*maybeNextChunkHeader)->m_info.m_payloadSize, Eq(2u * sizeof(DummySample)));
+    EXPECT_THAT((*maybeNextChunkHeader)->m_info.m_usedSizeOfChunk, Eq(payloadOffset + 2u * sizeof(DummySample)));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+}
+
+TEST_F(ChunkSender_test, NoReuseOfLastWithDifferentLayout)
+{
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSender.send(*maybeChunkHeader);
+
+    const iox::mepoo::ChunkLayout layout{iox::mepoo::ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT, 16u};
+    auto maybeNextChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId(), layout);
+
+    ASSERT_FALSE(maybeNextChunkHeader.has_error());
+    EXPECT_THAT(*maybeNextChunkHeader, Ne(*maybeChunkHeader));
+    EXPECT_THAT((*maybeNextChunkHeader)->m_userHeaderSize, Eq(16u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2u));
+}
+
+TEST_F(ChunkSender_test, NoReuseOfLastIfPayloadDoesNotFitBehindPayloadOffset)
+{
+    const iox::mepoo::ChunkLayout layout{64u, 0u};
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(sizeof(DummySample), iox::UniquePortId(), layout);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = *maybeChunkHeader;
+    m_chunkSender.send(chunkHeader);
+
+    // one byte more than fits behind the payload offset of the last chunk
+    const uint32_t payloadSize = chunkHeader->m_info.m_totalSizeOfChunk - chunkHeader->m_payloadOffset + 1u;
+    auto maybeNextChunkHeader = m_chunkSender.tryAllocate(payloadSize, iox::UniquePortId(), layout);
+
+    ASSERT_FALSE(maybeNextChunkHeader.has_error());
+    EXPECT_THAT(*maybeNextChunkHeader, Ne(chunkHeader));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1u));
+}
+
 TEST_F(ChunkSender_test, NoReuseOfLastIfBigger)
 {
     auto maybeChunkHeader = m_chunkSender.tryAllocate(SMALL_CHUNK, iox::UniquePortId());
@@ -600,3 +678,228 @@ TEST_F(ChunkSender_test, Cleanup)
 
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
 }
+
+TEST_F(ChunkSender_test, allocateWithMagazineAcquiresBatchOfChunks)
+{
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineHasValidChunkHeader)
+{
+    iox::UniquePortId uniqueId;
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    (*maybeChunkHeader)->m_info.m_externalSequenceNumber_bl = true;
+    m_chunkSenderWithMagazine.release(*maybeChunkHeader);
+
+    // the released chunk is taken out of the magazine again and must not contain any data of the previous allocation
+    maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(2u * sizeof(DummySample), uniqueId);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->m_originId, Eq(uniqueId));
+    EXPECT_FALSE((*maybeChunkHeader)->m_info.m_externalSequenceNumber_bl);
+    EXPECT_THAT((*maybeChunkHeader)->m_info.m_payloadSize, Eq(2u * sizeof(DummySample)));
+    EXPECT_THAT((*maybeChunkHeader)->m_info.m_usedSizeOfChunk,
+                Eq(2u * sizeof(DummySample) + sizeof(iox::mepoo::ChunkHeader)));
+    EXPECT_THAT((*maybeChunkHeader)->m_info.m_totalSizeOfChunk, Eq(m_memoryManager.getMemPoolInfo(0).m_chunkSize));
+}
+
+TEST_F(ChunkSender_test, releaseWithMagazineStoresChunkInMagazine)
+{
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSenderWithMagazine.release(*maybeChunkHeader);
+
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+}
+
+TEST_F(ChunkSender_test, releaseWithFullMagazineReturnsChunkToMempool)
+{
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    for (uint32_t i = 0; i < MAGAZINE_CAPACITY + 1u; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2u * MAGAZINE_CAPACITY));
+
+    for (auto chunk : chunks)
+    {
+        m_chunkSenderWithMagazine.release(chunk);
+    }
+
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+}
+
+TEST_F(ChunkSender_test, releaseWithFullMagazineHandsBackHalfOfTheChunksInOneBatch)
+{
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    for (uint32_t i = 0; i < MAGAZINE_CAPACITY + 1u; i++)
+    {
+        auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+    ASSERT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+
+    m_chunkSenderWithMagazine.release(chunks[0]);
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY));
+
+    m_chunkSenderWithMagazine.release(chunks[1]);
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY / 2u + 1u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(MAGAZINE_CAPACITY / 2u + 1u + MAGAZINE_CAPACITY - 1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineHandsBackCachedChunksWhenMempoolIsExhaustedByOthers)
+{
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ASSERT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0; i < NUM_CHUNKS_IN_POOL - MAGAZINE_CAPACITY; i++)
+    {
+        chunks.push_back(m_memoryManager.getChunk(sizeof(DummySample)));
+        ASSERT_THAT(chunks.back(), Eq(true));
+    }
+    EXPECT_THAT(m_memoryManager.getChunk(sizeof(DummySample)), Eq(false));
+
+    // the magazine hands back its cached chunks and takes only the requested one
+    maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_CHUNKS_IN_POOL - MAGAZINE_CAPACITY + 2u));
+    EXPECT_THAT(m_memoryManager.getChunk(sizeof(DummySample)), Eq(true));
+}
+
+TEST_F(ChunkSender_test, getChunkFromMagazineWithCustomLayoutBypassesMagazine)
+{
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ASSERT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+
+    const iox::mepoo::ChunkLayout layout{iox::mepoo::ChunkLayout::DEFAULT_PAYLOAD_ALIGNMENT, sizeof(uint64_t)};
+    auto chunk = m_chunkSenderWithMagazineData.m_chunkMagazine.getChunk(&m_memoryManager, sizeof(DummySample), layout);
+
+    ASSERT_THAT(chunk, Eq(true));
+    EXPECT_THAT(chunk.getChunkHeader()->userHeader(), Ne(nullptr));
+    EXPECT_THAT(chunk.getChunkHeader()->m_userHeaderSize, Eq(sizeof(uint64_t)));
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY + 1u));
+
+    // a chunk with a custom layout is not taken back into the magazine
+    EXPECT_FALSE(m_chunkSenderWithMagazineData.m_chunkMagazine.tryStore(chunk));
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineFromOtherMempoolBypassesMagazine)
+{
+    auto smallChunk = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    auto bigChunk = m_chunkSenderWithMagazine.tryAllocate(BIG_CHUNK, iox::UniquePortId());
+
+    ASSERT_FALSE(smallChunk.has_error());
+    ASSERT_FALSE(bigChunk.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(1u));
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(MAGAZINE_CAPACITY - 1u));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineFromAlmostExhaustedMempoolAcquiresRemainingChunks)
+{
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0; i < NUM_CHUNKS_IN_POOL - 1u; i++)
+    {
+        chunks.push_back(m_memoryManager.getChunk(sizeof(DummySample)));
+    }
+
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_CHUNKS_IN_POOL));
+
+    maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineFromExhaustedMempoolFollowsSpillOverPolicy)
+{
+    constexpr uint32_t NUM_SMALL_CHUNKS{MAGAZINE_CAPACITY / 2u};
+    iox::mepoo::MePooConfig mempoolconf;
+    mempoolconf.addMemPool({SMALL_CHUNK, NUM_SMALL_CHUNKS});
+    mempoolconf.addMemPool({BIG_CHUNK, NUM_CHUNKS_IN_POOL});
+    mempoolconf.setSpillOverMemPools(1u);
+    std::unique_ptr<uint8_t[]> memory(new uint8_t[MEMORY_SIZE]);
+    iox::posix::Allocator allocator{memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolconf, &allocator, &allocator);
+    ChunkSenderWithMagazineData_t chunkSenderData{&memoryManager, 0};
+    iox::popo::ChunkSender<ChunkSenderWithMagazineData_t> sut{&chunkSenderData};
+
+    // the refill takes the remaining chunks from the next larger mempool
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    for (uint32_t i = 0; i < MAGAZINE_CAPACITY; i++)
+    {
+        auto maybeChunkHeader = sut.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        EXPECT_THAT((*maybeChunkHeader)->m_info.m_payloadSize, Eq(sizeof(DummySample)));
+        chunks.push_back(*maybeChunkHeader);
+    }
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_SMALL_CHUNKS));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_spilledChunks, Eq(MAGAZINE_CAPACITY - NUM_SMALL_CHUNKS));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(MAGAZINE_CAPACITY - NUM_SMALL_CHUNKS));
+    const auto numberOfBigChunks =
+        std::count_if(chunks.begin(), chunks.end(), [&](iox::mepoo::ChunkHeader* chunkHeader) {
+            return chunkHeader->m_info.m_totalSizeOfChunk == memoryManager.getMemPoolInfo(1).m_chunkSize;
+        });
+    EXPECT_THAT(numberOfBigChunks, Eq(MAGAZINE_CAPACITY - NUM_SMALL_CHUNKS));
+
+    // only the chunks of the best fitting mempool are taken back into the magazine
+    for (auto chunk : chunks)
+    {
+        sut.release(chunk);
+    }
+    EXPECT_THAT(chunkSenderData.m_chunkMagazine.size(), Eq(NUM_SMALL_CHUNKS));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0u));
+
+    sut.releaseAll();
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkSender_test, allocateWithMagazineAndCustomLayoutBypassesMagazine)
+{
+    const iox::mepoo::ChunkLayout layout{64u, 16u};
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId(), layout);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->m_userHeaderSize, Eq(16u));
+    EXPECT_THAT(reinterpret_cast<uint64_t>((*maybeChunkHeader)->payload()) % 64u, Eq(0u));
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+
+    // the chunk with the custom layout is not taken back into the magazine
+    m_chunkSenderWithMagazine.release(*maybeChunkHeader);
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
+
+TEST_F(ChunkSender_test, CleanupWithMagazineReleasesCachedChunks)
+{
+    auto maybeChunkHeader = m_chunkSenderWithMagazine.tryAllocate(sizeof(DummySample), iox::UniquePortId());
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(MAGAZINE_CAPACITY));
+
+    m_chunkSenderWithMagazine.releaseAll();
+
+    EXPECT_THAT(m_chunkSenderWithMagazineData.m_chunkMagazine.size(), Eq(0u));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
+}
@@ -141,6 +141,94 @@ TEST_F(ConditionVariable_test, NotifyWhileWaitingResultsNoTimeoutMultiThreaded)
     waiter.join();
 }
 
+TEST_F(ConditionVariable_test, NotifyWhileWaiterPollsDoesNotPostSemaphore)
+{
+    m_condVarData.m_isWaiterPolling.store(true);
+    m_signaler.notifyOne();
+    m_condVarData.m_isWaiterPolling.store(false);
+
+    int semaphoreValue{-1};
+    ASSERT_TRUE(m_condVarData.m_semaphore.getValue(semaphoreValue));
+    EXPECT_THAT(semaphoreValue, Eq(0));
+    EXPECT_TRUE(m_condVarData.m_wasNotified.load());
+}
+
+TEST_F(ConditionVariable_test, NotifyWithoutPollingWaiterPostsSemaphore)
+{
+    m_signaler.notifyOne();
+
+    int semaphoreValue{-1};
+    ASSERT_TRUE(m_condVarData.m_semaphore.getValue(semaphoreValue));
+    EXPECT_THAT(semaphoreValue, Eq(1));
+}
+
+TEST_F(ConditionVariable_test, NotifySeenWhilePollingResultsInNoWaitSingleThreaded)
+{
+    m_waiter.setWaitStrategy(WaitStrategy(10U, 10U));
+    m_condVarData.m_isWaiterPolling.store(true);
+    m_signaler.notifyOne();
+    m_condVarData.m_isWaiterPolling.store(false);
+
+    m_waiter.wait();
+    // We expect that the next line is reached
+    EXPECT_FALSE(m_condVarData.m_wasNotified.load());
+    EXPECT_FALSE(m_condVarData.m_isWaiterPolling.load());
+}
+
+TEST_F(ConditionVariable_test, NotifyConsumedByPollingDoesNotWakeUpNextWait)
+{
+    // the signaler does not see a polling waiter and posts the semaphore as well
+    m_signaler.notifyOne();
+    m_waiter.setWaitStrategy(WaitStrategy(10U, 10U));
+
+    EXPECT_TRUE(m_waiter.timedWait(10_ms));
+
+    int semaphoreValue{-1};
+    ASSERT_TRUE(m_condVarData.m_semaphore.getValue(semaphoreValue));
+    EXPECT_THAT(semaphoreValue, Eq(0));
+    EXPECT_FALSE(m_waiter.timedWait(10_ms));
+}
+
+TEST_F(ConditionVariable_test, NoNotifyWithPollingWaitStrategyResultsInTimeoutSingleThreaded)
+{
+    m_waiter.setWaitStrategy(WaitStrategy(10U, 10U));
+    EXPECT_FALSE(m_waiter.timedWait(10_ms));
+    EXPECT_FALSE(m_condVarData.m_isWaiterPolling.load());
+}
+
+TEST_F(ConditionVariable_test, ResetDiscardsNotificationOfPollingWaiter)
+{
+    m_condVarData.m_isWaiterPolling.store(true);
+    m_signaler.notifyOne();
+    m_condVarData.m_isWaiterPolling.store(false);
+    m_waiter.setWaitStrategy(WaitStrategy(10U, 10U));
+
+    m_waiter.reset();
+
+    EXPECT_FALSE(m_waiter.timedWait(10_ms));
+}
+
+TEST_F(ConditionVariable_test, NotifyWhilePollingOrBlockingResultsInTriggerMultiThreaded)
+{
+    // with few iterations the notification arrives either while the waiter polls or after it blocked
+    for (uint64_t spinIterations : {0U, 10U, 1000000U})
+    {
+        m_waiter.setWaitStrategy(WaitStrategy(spinIterations, 10U));
+        std::atomic<int> counter{0};
+        std::thread waiter([&] {
+            EXPECT_THAT(counter, Eq(0));
+            m_syncSemaphore.post();
+            m_waiter.wait();
+            EXPECT_THAT(counter, Eq(1));
+        });
+        m_syncSemaphore.wait();
+        counter++;
+        m_signaler.notifyOne();
+        waiter.join();
+        m_waiter.reset();
+    }
+}
+
 TEST_F(ConditionVariable_test, DISABLED_MoveConditionVariableSignalerIsSuccessful)
 {
     /// @todo move c'tor currently deleted
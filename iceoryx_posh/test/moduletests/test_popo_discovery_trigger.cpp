@@ -0,0 +1,94 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/popo/ports/discovery_trigger.hpp"
+
+#include "test.hpp"
+#include <atomic>
+#include <thread>
+
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DiscoveryTrigger_test : public Test
+{
+  public:
+    void SetUp(){};
+    void TearDown(){};
+
+    DiscoveryTrigger m_sut;
+};
+
+TEST_F(DiscoveryTrigger_test, NoNotificationResultsInNoPortKinds)
+{
+    EXPECT_THAT(m_sut.takeNotifiedPortKinds(), Eq(0u));
+}
+
+TEST_F(DiscoveryTrigger_test, NoNotificationResultsInTimeout)
+{
+    EXPECT_FALSE(m_sut.timedWait(10_ms));
+}
+
+TEST_F(DiscoveryTrigger_test, NotifiedPortKindsAreCollected)
+{
+    m_sut.notify(DiscoveryTrigger::PortKind::SENDER);
+    m_sut.notify(DiscoveryTrigger::PortKind::INTERFACE);
+    m_sut.notify(DiscoveryTrigger::PortKind::SENDER);
+
+    auto portKinds = m_sut.takeNotifiedPortKinds();
+
+    EXPECT_TRUE(DiscoveryTrigger::contains(portKinds, DiscoveryTrigger::PortKind::SENDER));
+    EXPECT_TRUE(DiscoveryTrigger::contains(portKinds, DiscoveryTrigger::PortKind::INTERFACE));
+    EXPECT_FALSE(DiscoveryTrigger::contains(portKinds, DiscoveryTrigger::PortKind::RECEIVER));
+    EXPECT_FALSE(DiscoveryTrigger::contains(portKinds, DiscoveryTrigger::PortKind::APPLICATION));
+    EXPECT_FALSE(DiscoveryTrigger::contains(portKinds, DiscoveryTrigger::PortKind::RUNNABLE));
+}
+
+TEST_F(DiscoveryTrigger_test, TakeNotifiedPortKindsResetsPortKinds)
+{
+    m_sut.notify(DiscoveryTrigger::PortKind::RECEIVER);
+    m_sut.takeNotifiedPortKinds();
+
+    EXPECT_THAT(m_sut.takeNotifiedPortKinds(), Eq(0u));
+}
+
+TEST_F(DiscoveryTrigger_test, TimedWaitWithPendingNotificationReturnsImmediately)
+{
+    m_sut.notify(DiscoveryTrigger::PortKind::APPLICATION);
+
+    EXPECT_TRUE(m_sut.timedWait(10_ms));
+    EXPECT_TRUE(m_sut.timedWait(10_ms));
+}
+
+TEST_F(DiscoveryTrigger_test, TimedWaitAfterTakenNotificationResultsInTimeout)
+{
+    m_sut.notify(DiscoveryTrigger::PortKind::APPLICATION);
+    m_sut.takeNotifiedPortKinds();
+
+    EXPECT_FALSE(m_sut.timedWait(10_ms));
+}
+
+TEST_F(DiscoveryTrigger_test, NotifyWakesUpWaitingThread)
+{
+    std::atomic_bool wasNotified{false};
+    std::thread waiter([&] { wasNotified = m_sut.timedWait(10000_ms); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_sut.notify(DiscoveryTrigger::PortKind::RUNNABLE);
+    waiter.join();
+
+    EXPECT_TRUE(wasNotified);
+    EXPECT_TRUE(DiscoveryTrigger::contains(m_sut.takeNotifiedPortKinds(), DiscoveryTrigger::PortKind::RUNNABLE));
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+
+#include "iceoryx_posh/internal/popo/latency_histogram.hpp"
+
+#include <limits>
+
+using namespace ::testing;
+
+using iox::mepoo::DurationNs;
+using iox::popo::LatencyHistogram;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    LatencyHistogram m_sut;
+};
+
+TEST_F(LatencyHistogram_test, IsEmptyOnStartup)
+{
+    EXPECT_THAT(m_sut.getCount(), Eq(0u));
+    EXPECT_THAT(m_sut.getSumInNanoseconds(), Eq(0u));
+    EXPECT_THAT(m_sut.getMaxInNanoseconds(), Eq(0u));
+    for (uint32_t i = 0u; i < iox::NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS; ++i)
+    {
+        EXPECT_THAT(m_sut.getBucket(i), Eq(0u));
+    }
+}
+
+TEST_F(LatencyHistogram_test, LatencyBelowOneMicrosecondIsCountedInFirstBucket)
+{
+    EXPECT_THAT(LatencyHistogram::bucketIndex(0u), Eq(0u));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(999u), Eq(0u));
+}
+
+TEST_F(LatencyHistogram_test, BucketsDoubleTheirRange)
+{
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1000u), Eq(1u));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(1999u), Eq(1u));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(2000u), Eq(2u));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(3999u), Eq(2u));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(4000u), Eq(3u));
+}
+
+TEST_F(LatencyHistogram_test, LargeLatencyIsCountedInLastBucket)
+{
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(iox::NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS - 1u));
+}
+
+TEST_F(LatencyHistogram_test, RecordUpdatesBucketCountSumAndMax)
+{
+    m_sut.record(DurationNs(1500));
+    m_sut.record(DurationNs(500));
+    m_sut.record(DurationNs(1200));
+
+    EXPECT_THAT(m_sut.getBucket(0u), Eq(1u));
+    EXPECT_THAT(m_sut.getBucket(1u), Eq(2u));
+    EXPECT_THAT(m_sut.getCount(), Eq(3u));
+    EXPECT_THAT(m_sut.getSumInNanoseconds(), Eq(3200u));
+    EXPECT_THAT(m_sut.getMaxInNanoseconds(), Eq(1500u));
+}
+
+TEST_F(LatencyHistogram_test, NegativeLatencyIsRecordedAsZero)
+{
+    m_sut.record(DurationNs(-42));
+
+    EXPECT_THAT(m_sut.getBucket(0u), Eq(1u));
+    EXPECT_THAT(m_sut.getSumInNanoseconds(), Eq(0u));
+}
+
+TEST_F(LatencyHistogram_test, InvalidBucketIndexReturnsZero)
+{
+    m_sut.record(DurationNs(0));
+
+    EXPECT_THAT(m_sut.getBucket(iox::NUMBER_OF_LATENCY_HISTOGRAM_BUCKETS), Eq(0u));
+}
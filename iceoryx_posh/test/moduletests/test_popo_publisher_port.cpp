@@ -179,6 +179,20 @@ TEST_F(PublisherPort_test, allocatingAChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
 }
 
+TEST_F(PublisherPort_test, allocatingAChunkWithCustomLayout)
+{
+    const iox::mepoo::ChunkLayout layout{64u, 8u};
+    auto maybeChunkHeader = m_sutUserSide.tryAllocateChunk(10u, layout);
+
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    auto chunkHeader = maybeChunkHeader.get_value();
+    EXPECT_THAT(reinterpret_cast<uint64_t>(chunkHeader->payload()) % 64u, Eq(0u));
+    EXPECT_THAT(chunkHeader->m_userHeaderSize, Eq(8u));
+    EXPECT_THAT(chunkHeader->m_originId, Eq(m_sutUserSide.getUniqueID()));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1u));
+    m_sutUserSide.freeChunk(chunkHeader);
+}
+
 TEST_F(PublisherPort_test, freeingAnAllocatedChunkReleasesTheMemory)
 {
     auto maybeChunkHeader = m_sutUserSide.tryAllocateChunk(10u);
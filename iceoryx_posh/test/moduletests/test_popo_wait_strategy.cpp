@@ -0,0 +1,67 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/popo/wait_strategy.hpp"
+#include "test.hpp"
+
+using namespace ::testing;
+using iox::popo::WaitStrategy;
+
+TEST(WaitStrategy_test, DefaultStrategyBlocksRightAway)
+{
+    WaitStrategy sut;
+
+    EXPECT_TRUE(sut.isBlockingOnly());
+    EXPECT_THAT(sut.getSpinIterations(), Eq(0U));
+    EXPECT_THAT(sut.getYieldIterations(), Eq(0U));
+}
+
+TEST(WaitStrategy_test, StrategyWithIterationsPolls)
+{
+    EXPECT_FALSE(WaitStrategy(1U, 0U).isBlockingOnly());
+    EXPECT_FALSE(WaitStrategy(0U, 1U).isBlockingOnly());
+}
+
+TEST(WaitStrategy_test, PollUntilChecksPredicateForAllSpinAndYieldIterations)
+{
+    WaitStrategy sut(7U, 3U);
+    uint64_t numberOfChecks{0U};
+
+    EXPECT_FALSE(sut.pollUntil([&] {
+        ++numberOfChecks;
+        return false;
+    }));
+    EXPECT_THAT(numberOfChecks, Eq(10U));
+}
+
+TEST(WaitStrategy_test, PollUntilStopsAsSoonAsPredicateIsTrue)
+{
+    WaitStrategy sut(7U, 3U);
+    uint64_t numberOfChecks{0U};
+
+    EXPECT_TRUE(sut.pollUntil([&] { return ++numberOfChecks == 9U; }));
+    EXPECT_THAT(numberOfChecks, Eq(9U));
+}
+
+TEST(WaitStrategy_test, BlockingOnlyStrategyDoesNotCheckPredicate)
+{
+    WaitStrategy sut;
+    uint64_t numberOfChecks{0U};
+
+    EXPECT_FALSE(sut.pollUntil([&] {
+        ++numberOfChecks;
+        return true;
+    }));
+    EXPECT_THAT(numberOfChecks, Eq(0U));
+}
@@ -372,3 +372,34 @@ TEST_F(WaitSet_test, NotifyGuardConditionOnceTimedWaitResultsInResetOfTrigger)
     EXPECT_THAT(fulfilledConditions2.size(), Eq(0));
     m_sut.detachCondition(guardCond);
 }
+
+TEST_F(WaitSet_test, NotifyGuardConditionWhileWaitingWithPollingWaitStrategyResultsInTriggerMultiThreaded)
+{
+    std::atomic<int> counter{0};
+    GuardCondition guardCond;
+    m_sut.attachCondition(guardCond);
+    m_sut.setWaitStrategy(WaitStrategy(1000U, 100U));
+    std::thread waiter([&] {
+        EXPECT_THAT(counter, Eq(0));
+        m_syncSemaphore.post();
+        auto fulfilledConditions = m_sut.wait();
+        EXPECT_THAT(fulfilledConditions.size(), Eq(1));
+        EXPECT_THAT(fulfilledConditions.front(), &guardCond);
+        EXPECT_THAT(counter, Eq(1));
+    });
+    m_syncSemaphore.wait();
+    counter++;
+    guardCond.trigger();
+    waiter.join();
+    m_sut.detachCondition(guardCond);
+}
+
+TEST_F(WaitSet_test, TimeoutOfTimedWaitWithPollingWaitStrategyResultsInEmptyVector)
+{
+    GuardCondition guardCond;
+    m_sut.attachCondition(guardCond);
+    m_sut.setWaitStrategy(WaitStrategy(1000U, 100U));
+    auto fulfilledConditions = m_sut.timedWait(1_ms);
+    EXPECT_THAT(fulfilledConditions.size(), Eq(0));
+    m_sut.detachCondition(guardCond);
+}
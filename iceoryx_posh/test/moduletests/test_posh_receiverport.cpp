@@ -167,6 +167,30 @@ TEST_F(ReceiverPort_test, releaseChunk)
     EXPECT_THAT(m_receiver->newData(), Eq(false));
 }
 
+TEST_F(ReceiverPort_test, deliverPostsSemaphoreOnlyWhenWaiterDoesNotPoll)
+{
+    SubscribeReceiverToSender(m_receiver, m_sender);
+    auto semaphore = m_receiver->GetShmSemaphore();
+    ASSERT_THAT(semaphore, Ne(nullptr));
+    m_receiver->SetCallbackReferences(semaphore);
+
+    m_receiver->setWaiterPolling(true);
+    auto delivery = m_sender->reserveChunk(sizeof(int));
+    m_sender->deliverChunk(delivery);
+    int semaphoreValue{-1};
+    ASSERT_TRUE(semaphore->getValue(semaphoreValue));
+    EXPECT_THAT(semaphoreValue, Eq(0));
+    EXPECT_THAT(m_receiver->newData(), Eq(true));
+
+    m_receiver->setWaiterPolling(false);
+    delivery = m_sender->reserveChunk(sizeof(int));
+    m_sender->deliverChunk(delivery);
+    ASSERT_TRUE(semaphore->getValue(semaphoreValue));
+    EXPECT_THAT(semaphoreValue, Eq(1));
+
+    m_receiver->UnsetCallbackReferences();
+}
+
 // test the state machine logic (unit test does not account for concurrency)
 // here the common use cases are tested
 ///@todo: do we cover all relevant cases?
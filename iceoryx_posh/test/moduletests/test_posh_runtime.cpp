@@ -175,7 +175,9 @@ TEST_F(PoshRuntime_test, GetMiddlewareInterfaceIsSuccessful)
     EXPECT_EQ(m_runtimeName, interfacePortData->m_processName);
     EXPECT_EQ(iox::capro::ServiceDescription(0u, 0u, 0u), interfacePortData->m_serviceDescription);
     EXPECT_EQ(false, interfacePortData->m_toBeDestroyed);
-    EXPECT_EQ(true, interfacePortData->m_doInitialOfferForward);
+    // a new interface port notifies the discovery, RouDi does the initial offer forwarding right away
+    m_roudiEnv.InterOpWait();
+    EXPECT_EQ(false, interfacePortData->m_doInitialOfferForward);
 }
 
 
@@ -225,6 +227,89 @@ TEST_F(PoshRuntime_test, SendRequestToRouDiInvalidMessage)
     EXPECT_FALSE(successfullySent);
 }
 
+TEST_F(PoshRuntime_test, RegistrationWithBinaryProtocolIsSuccessful)
+{
+    using namespace iox::units::duration_literals;
+    MqRuntimeInterface binaryInterface(iox::MQ_ROUDI_NAME, "/binaryApp", 1_s, MqProtocol::BINARY);
+
+    EXPECT_THAT(binaryInterface.getProtocol(), Eq(MqProtocol::BINARY));
+    EXPECT_THAT(binaryInterface.getShmTopicSize(), Gt(0u));
+    EXPECT_FALSE(binaryInterface.getSegmentManagerAddr().empty());
+}
+
+TEST_F(PoshRuntime_test, BinaryRequestToCreatePublisherIsAnsweredWithBinaryAck)
+{
+    MqBinaryMessage sendBuffer;
+    sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_PUBLISHER))
+        .addString(m_runtimeName)
+        .addServiceDescription({"radar", "front", "objects"})
+        .addUnsigned(0u)
+        .addString(m_runnableName)
+        .addPortConfigInfo(PortConfigInfo());
+    MqBinaryMessage receiveBuffer;
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(sendBuffer, receiveBuffer));
+
+    int64_t type{0};
+    uint64_t offset{0u};
+    uint64_t segmentId{0u};
+    ASSERT_TRUE(receiveBuffer.readSigned(type));
+    EXPECT_THAT(type, Eq(static_cast<int64_t>(MqMessageType::CREATE_PUBLISHER_ACK)));
+    EXPECT_TRUE(receiveBuffer.readUnsigned(offset));
+    EXPECT_TRUE(receiveBuffer.readUnsigned(segmentId));
+}
+
+TEST_F(PoshRuntime_test, BinaryFindServiceReturnsOfferedInstances)
+{
+    m_runtime->offerService({"service1", "instance1"});
+    m_runtime->offerService({"service1", "instance2"});
+    this->InterOpWait();
+
+    MqBinaryMessage sendBuffer;
+    sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::FIND_SERVICE))
+        .addString(m_runtimeName)
+        .addServiceDescription({"service1", iox::capro::AnyInstanceString});
+    MqBinaryMessage receiveBuffer;
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(sendBuffer, receiveBuffer));
+
+    uint64_t numberOfInstances{0u};
+    iox::capro::IdString instance1;
+    iox::capro::IdString instance2;
+    ASSERT_TRUE(receiveBuffer.readUnsigned(numberOfInstances));
+    EXPECT_THAT(numberOfInstances, Eq(2u));
+    ASSERT_TRUE(receiveBuffer.readString(instance1));
+    ASSERT_TRUE(receiveBuffer.readString(instance2));
+    EXPECT_TRUE((instance1 == iox::capro::IdString("instance1") && instance2 == iox::capro::IdString("instance2"))
+                || (instance1 == iox::capro::IdString("instance2") && instance2 == iox::capro::IdString("instance1")));
+}
+
+TEST_F(PoshRuntime_test, UnsupportedBinaryRequestIsAnsweredWithBinaryMessageNotSupported)
+{
+    MqBinaryMessage sendBuffer;
+    sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_INTERFACE)).addString(m_runtimeName);
+    MqBinaryMessage receiveBuffer;
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(sendBuffer, receiveBuffer));
+
+    int64_t type{0};
+    ASSERT_TRUE(receiveBuffer.readSigned(type));
+    EXPECT_THAT(type, Eq(static_cast<int64_t>(MqMessageType::MESSAGE_NOT_SUPPORTED)));
+}
+
+TEST_F(PoshRuntime_test, MalformedBinaryRequestIsAnsweredWithBinaryMessageNotSupported)
+{
+    MqBinaryMessage sendBuffer;
+    sendBuffer.addSigned(static_cast<int64_t>(MqMessageType::CREATE_PUBLISHER)).addString(m_runtimeName);
+    MqBinaryMessage receiveBuffer;
+
+    ASSERT_TRUE(m_runtime->sendRequestToRouDi(sendBuffer, receiveBuffer));
+
+    int64_t type{0};
+    ASSERT_TRUE(receiveBuffer.readSigned(type));
+    EXPECT_THAT(type, Eq(static_cast<int64_t>(MqMessageType::MESSAGE_NOT_SUPPORTED)));
+}
+
 /// @deprecated #25
 TEST_F(PoshRuntime_test, GetMiddlewareSenderIsSuccessful)
 {
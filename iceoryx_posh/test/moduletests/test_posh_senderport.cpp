@@ -377,6 +377,51 @@ TEST_F(SenderPort_test, testCaPro)
     m_receiver2->releaseChunk(receivedSample);
 }
 
+TEST_F(SenderPort_test, latencyTracingIsDisabledOnStartup)
+{
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    ReceiveDummyData();
+
+    EXPECT_FALSE(m_sender->isLatencyTracingEnabled());
+    EXPECT_THAT(m_sender->getAllocateToSendLatency().getCount(), Eq(0u));
+    EXPECT_THAT(m_receiver->getSendToDeliverLatency().getCount(), Eq(0u));
+    EXPECT_THAT(m_receiver->getSendToGetLatency().getCount(), Eq(0u));
+    EXPECT_THAT(m_receiver->getSendToReleaseLatency().getCount(), Eq(0u));
+}
+
+TEST_F(SenderPort_test, latencyTracingRecordsEveryTracingPoint)
+{
+    m_sender->enableLatencyTracing();
+
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    EXPECT_TRUE(sample->m_info.m_isLatencyTraced);
+    m_sender->deliverChunk(sample);
+    ReceiveDummyData();
+
+    EXPECT_THAT(m_sender->getAllocateToSendLatency().getCount(), Eq(1u));
+    EXPECT_THAT(m_receiver->getSendToDeliverLatency().getCount(), Eq(1u));
+    EXPECT_THAT(m_receiver->getSendToGetLatency().getCount(), Eq(1u));
+    EXPECT_THAT(m_receiver->getSendToReleaseLatency().getCount(), Eq(1u));
+}
+
+TEST_F(SenderPort_test, recycledChunkIsNotTracedAfterLatencyTracingWasDisabled)
+{
+    m_sender->enableLatencyTracing();
+    auto sample = m_sender->reserveChunk(sizeof(DummySample));
+    m_sender->deliverChunk(sample);
+    ReceiveDummyData();
+
+    m_sender->disableLatencyTracing();
+    sample = m_sender->reserveChunk(sizeof(DummySample));
+    EXPECT_FALSE(sample->m_info.m_isLatencyTraced);
+    m_sender->deliverChunk(sample);
+    ReceiveDummyData();
+
+    EXPECT_THAT(m_sender->getAllocateToSendLatency().getCount(), Eq(1u));
+    EXPECT_THAT(m_receiver->getSendToReleaseLatency().getCount(), Eq(1u));
+}
+
 TEST_F(SenderPort_testLatchedTopic, getSameSampleAfterOneDeliver)
 {
     auto sample = m_sender->reserveChunk(sizeof(DummySample));
@@ -0,0 +1,187 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#define private public
+#include "iceoryx_posh/internal/runtime/service_registry_table.hpp"
+#undef private
+
+using namespace ::testing;
+
+using iox::capro::IdString;
+using iox::runtime::ServiceRegistryTable;
+
+class ServiceRegistryTable_test : public Test
+{
+  public:
+    bool find(const IdString& service, const IdString& instance)
+    {
+        return m_sut->find(service, instance, m_instances, m_numberOfFoundInstances);
+    }
+
+    // the table is too large for the stack
+    std::unique_ptr<ServiceRegistryTable> m_sut{new ServiceRegistryTable()};
+    iox::runtime::InstanceContainer m_instances;
+    uint64_t m_numberOfFoundInstances{0U};
+    const IdString m_anyInstance{iox::capro::AnyInstanceString};
+};
+
+TEST_F(ServiceRegistryTable_test, FindInEmptyTableFindsNothing)
+{
+    EXPECT_TRUE(find("a", m_anyInstance));
+
+    EXPECT_THAT(m_instances.size(), Eq(0U));
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(0U));
+}
+
+TEST_F(ServiceRegistryTable_test, FindsAddedInstance)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+
+    EXPECT_TRUE(find("a", "b"));
+
+    ASSERT_THAT(m_instances.size(), Eq(1U));
+    EXPECT_THAT(m_instances[0], Eq(IdString("b")));
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(1U));
+}
+
+TEST_F(ServiceRegistryTable_test, FindDoesNotFindOtherInstanceOrService)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+
+    EXPECT_TRUE(find("a", "c"));
+    EXPECT_THAT(m_instances.size(), Eq(0U));
+    EXPECT_TRUE(find("c", "b"));
+    EXPECT_THAT(m_instances.size(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryTable_test, FindWithAnyInstanceFindsAllInstancesOfService)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+    ASSERT_TRUE(m_sut->add("a", "c"));
+    ASSERT_TRUE(m_sut->add("d", "e"));
+
+    EXPECT_TRUE(find("a", m_anyInstance));
+
+    EXPECT_THAT(m_instances.size(), Eq(2U));
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(2U));
+}
+
+TEST_F(ServiceRegistryTable_test, AddingTheSamePairTwiceStoresItOnce)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+    ASSERT_TRUE(m_sut->add("a", "b"));
+
+    EXPECT_TRUE(find("a", m_anyInstance));
+
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(1U));
+}
+
+TEST_F(ServiceRegistryTable_test, RemovedInstanceIsNotFoundAnymore)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+    ASSERT_TRUE(m_sut->add("a", "c"));
+    ASSERT_TRUE(m_sut->add("a", "d"));
+
+    m_sut->remove("a", "b");
+
+    EXPECT_TRUE(find("a", m_anyInstance));
+    ASSERT_THAT(m_instances.size(), Eq(2U));
+    EXPECT_THAT(m_instances[0], Ne(IdString("b")));
+    EXPECT_THAT(m_instances[1], Ne(IdString("b")));
+}
+
+TEST_F(ServiceRegistryTable_test, RemovingUnknownPairChangesNothing)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+
+    m_sut->remove("a", "c");
+
+    EXPECT_TRUE(find("a", m_anyInstance));
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(1U));
+}
+
+TEST_F(ServiceRegistryTable_test, FindCountsInstancesWhichDoNotFitIntoTheContainer)
+{
+    for (uint32_t i = 0U; i < iox::MAX_NUMBER_OF_INSTANCES + 1U; ++i)
+    {
+        ASSERT_TRUE(m_sut->add("a", IdString(iox::cxx::TruncateToCapacity, std::to_string(i))));
+    }
+
+    EXPECT_TRUE(find("a", m_anyInstance));
+
+    EXPECT_THAT(m_instances.size(), Eq(iox::MAX_NUMBER_OF_INSTANCES));
+    EXPECT_THAT(m_numberOfFoundInstances, Eq(iox::MAX_NUMBER_OF_INSTANCES + 1U));
+}
+
+TEST_F(ServiceRegistryTable_test, FullTableCannotBeUsedForLookUps)
+{
+    for (uint32_t i = 0U; i < ServiceRegistryTable::CAPACITY; ++i)
+    {
+        ASSERT_TRUE(m_sut->add(IdString(iox::cxx::TruncateToCapacity, std::to_string(i)), "b"));
+    }
+
+    EXPECT_FALSE(m_sut->add("a", "b"));
+
+    EXPECT_FALSE(find("0", "b"));
+}
+
+TEST_F(ServiceRegistryTable_test, LookUpByRouDiRequiredDisablesLookUps)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+
+    m_sut->setLookupByRouDiRequired(true);
+    EXPECT_FALSE(find("a", "b"));
+
+    m_sut->setLookupByRouDiRequired(false);
+    EXPECT_TRUE(find("a", "b"));
+}
+
+TEST_F(ServiceRegistryTable_test, FindDuringWriteOfRouDiGivesUp)
+{
+    // RouDi died between the begin and the end of a write
+    m_sut->m_sequence.store(1U);
+
+    EXPECT_FALSE(find("a", "b"));
+}
+
+TEST_F(ServiceRegistryTable_test, ConcurrentFindsSeeEitherTheOldOrTheNewTable)
+{
+    ASSERT_TRUE(m_sut->add("a", "b"));
+    std::atomic_bool keepRunning{true};
+    std::thread writer([&] {
+        while (keepRunning)
+        {
+            m_sut->add("a", "c");
+            m_sut->remove("a", "c");
+        }
+    });
+
+    for (uint32_t i = 0U; i < 10000U; ++i)
+    {
+        if (find("a", m_anyInstance))
+        {
+            ASSERT_THAT(m_numberOfFoundInstances, AnyOf(Eq(1U), Eq(2U)));
+            EXPECT_THAT(m_instances[0], AnyOf(Eq(IdString("b")), Eq(IdString("c"))));
+        }
+    }
+    keepRunning = false;
+    writer.join();
+}
@@ -105,6 +105,7 @@ class MemPoolIntrospection_test : public Test
         info.m_minFreeChunks = index * 100 + 45;
         info.m_numChunks = index * 100 + 50;
         info.m_usedChunks = index * 100 + 3;
+        info.m_spilledChunks = index * 100 + 7;
     }
 
     // initializes the mempool info with a defined pattern
@@ -141,6 +142,10 @@ class MemPoolIntrospection_test : public Test
             {
                 return false;
             }
+            if (info.m_spilledChunks != second[index].m_spilledChunks)
+            {
+                return false;
+            }
             index++;
         }
 
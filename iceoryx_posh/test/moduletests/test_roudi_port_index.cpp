@@ -0,0 +1,136 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "iceoryx_posh/internal/roudi/port_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+using namespace ::testing;
+using iox::capro::ServiceDescription;
+using iox::roudi::PortIndex;
+
+namespace
+{
+struct PortDataMock
+{
+    PortDataMock(const ServiceDescription& service)
+        : m_serviceDescription(service)
+    {
+    }
+    ServiceDescription m_serviceDescription;
+};
+} // namespace
+
+class PortIndex_test : public Test
+{
+  public:
+    void SetUp(){};
+    void TearDown(){};
+
+    std::vector<PortDataMock*> getMatchingPorts(const ServiceDescription& service)
+    {
+        std::vector<PortDataMock*> ports;
+        m_sut.forEachMatchingPort(service, [&](PortDataMock* const port) { ports.push_back(port); });
+        return ports;
+    }
+
+    PortDataMock m_portA1{{1u, 1u, 1u}};
+    PortDataMock m_portA2{{1u, 1u, 1u}};
+    PortDataMock m_portB{{1u, 2u, 1u}};
+    PortDataMock m_portC{{2u, 1u, 1u}};
+    PortDataMock m_portAnyEvent{{1u, iox::capro::AnyEvent, 1u}};
+    PortIndex<PortDataMock> m_sut;
+};
+
+TEST_F(PortIndex_test, EmptyIndexHasNoMatchingPorts)
+{
+    EXPECT_THAT(m_sut.size(), Eq(0u));
+    EXPECT_TRUE(getMatchingPorts({1u, 1u, 1u}).empty());
+}
+
+TEST_F(PortIndex_test, LookupReturnsOnlyPortsWithEqualServiceDescription)
+{
+    m_sut.add(&m_portA1);
+    m_sut.add(&m_portB);
+    m_sut.add(&m_portC);
+    m_sut.add(&m_portA2);
+
+    EXPECT_THAT(m_sut.size(), Eq(4u));
+    EXPECT_THAT(getMatchingPorts({1u, 1u, 1u}), ElementsAre(&m_portA1, &m_portA2));
+    EXPECT_THAT(getMatchingPorts({1u, 2u, 1u}), ElementsAre(&m_portB));
+    EXPECT_TRUE(getMatchingPorts({3u, 1u, 1u}).empty());
+}
+
+TEST_F(PortIndex_test, LookupOfStringServiceDescriptionReturnsOnlyPortsWithEqualStrings)
+{
+    PortDataMock frontLeftPort{{"Radar", "FrontLeft", "Objects"}};
+    PortDataMock frontRightPort{{"Radar", "FrontRight", "Objects"}};
+    m_sut.add(&frontLeftPort);
+    m_sut.add(&frontRightPort);
+    m_sut.add(&m_portA1);
+
+    EXPECT_THAT(getMatchingPorts({"Radar", "FrontLeft", "Objects"}), ElementsAre(&frontLeftPort));
+    EXPECT_THAT(getMatchingPorts({"Radar", "FrontRight", "Objects"}), ElementsAre(&frontRightPort));
+    EXPECT_TRUE(getMatchingPorts({"Radar", "Rear", "Objects"}).empty());
+}
+
+TEST_F(PortIndex_test, LookupWithWildcardReturnsAllMatchingPorts)
+{
+    m_sut.add(&m_portA1);
+    m_sut.add(&m_portB);
+    m_sut.add(&m_portC);
+
+    EXPECT_THAT(getMatchingPorts({1u, iox::capro::AnyEvent, 1u}), UnorderedElementsAre(&m_portA1, &m_portB));
+}
+
+TEST_F(PortIndex_test, PortWithWildcardMatchesLookupWithoutWildcard)
+{
+    m_sut.add(&m_portAnyEvent);
+    m_sut.add(&m_portA1);
+
+    EXPECT_THAT(getMatchingPorts({1u, 2u, 1u}), ElementsAre(&m_portAnyEvent));
+    EXPECT_THAT(getMatchingPorts({1u, 1u, 1u}), ElementsAre(&m_portA1, &m_portAnyEvent));
+    EXPECT_TRUE(getMatchingPorts({2u, 1u, 1u}).empty());
+}
+
+TEST_F(PortIndex_test, RemovedPortsAreNotMatchingAnymore)
+{
+    m_sut.add(&m_portA1);
+    m_sut.add(&m_portA2);
+    m_sut.add(&m_portAnyEvent);
+
+    m_sut.remove(&m_portA1);
+    m_sut.remove(&m_portAnyEvent);
+
+    EXPECT_THAT(m_sut.size(), Eq(1u));
+    EXPECT_THAT(getMatchingPorts({1u, 1u, 1u}), ElementsAre(&m_portA2));
+
+    m_sut.remove(&m_portA2);
+
+    EXPECT_THAT(m_sut.size(), Eq(0u));
+    EXPECT_TRUE(getMatchingPorts({1u, 1u, 1u}).empty());
+}
+
+TEST_F(PortIndex_test, RemovingUnknownPortDoesNotChangeTheIndex)
+{
+    m_sut.add(&m_portA1);
+
+    m_sut.remove(&m_portA2);
+    m_sut.remove(&m_portB);
+
+    EXPECT_THAT(m_sut.size(), Eq(1u));
+    EXPECT_THAT(getMatchingPorts({1u, 1u, 1u}), ElementsAre(&m_portA1));
+}
@@ -291,6 +291,20 @@ TEST_F(PortIntrospection_test, sendData_OneSender)
     EXPECT_THAT(sentThroughputData.m_chunksPerMinute, DoubleEq(expectedThroughputData.m_chunksPerMinute));
     EXPECT_THAT(sentThroughputData.m_lastSendIntervalInNanoseconds,
                 Eq(expectedThroughputData.m_lastSendIntervalInNanoseconds));
+    EXPECT_THAT(sentThroughputData.m_allocateToSendLatency.m_count, Eq(0u));
+
+    senderPortData.m_allocateToSendLatency.record(DurationNs(1500));
+    SenderPort_MOCK::globalDetails = std::make_shared<SenderPort_MOCK::mock_t>();
+    SenderPort_MOCK::globalDetails->reserveSampleReturn = throughputTopic->chunkHeader();
+    m_introspectionAccess.sendThroughputData();
+    SenderPort_MOCK::globalDetails.reset();
+
+    ASSERT_THAT(throughputTopic->sample()->m_throughputList.size(), Eq(1));
+    auto sentLatency = throughputTopic->sample()->m_throughputList[0].m_allocateToSendLatency;
+    EXPECT_THAT(sentLatency.m_count, Eq(1u));
+    EXPECT_THAT(sentLatency.m_buckets[1], Eq(1u));
+    EXPECT_THAT(sentLatency.m_sumInNanoseconds, Eq(1500u));
+    EXPECT_THAT(sentLatency.m_maxInNanoseconds, Eq(1500u));
 }
 
 
@@ -0,0 +1,278 @@
+// Copyright (c) 2020 by Robert Bosch GmbH. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "test.hpp"
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/port_manager.hpp"
+#include "iceoryx_posh/internal/runtime/message_queue_interface.hpp"
+#include "iceoryx_posh/roudi/memory/iceoryx_roudi_memory_manager.hpp"
+#include "iceoryx_posh/version/version_info.hpp"
+#include "iceoryx_utils/internal/relocatable_pointer/relative_ptr.hpp"
+#include "iceoryx_utils/posix_wrapper/posix_access_rights.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define private public
+#include "iceoryx_posh/internal/roudi/roudi_process.hpp"
+#undef private
+
+using namespace ::testing;
+
+using iox::roudi::IceOryxRouDiMemoryManager;
+using iox::roudi::PortManager;
+using iox::roudi::ProcessManager;
+using iox::roudi::RouDiProcess;
+
+class ProcessManager_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        testing::internal::CaptureStderr();
+
+        auto config = iox::RouDiConfig_t().setDefaults();
+        m_roudiMemoryManager.reset(new IceOryxRouDiMemoryManager(config));
+        m_roudiMemoryManager->createAndAnnounceMemory();
+        m_portManager.reset(new PortManager(m_roudiMemoryManager.get()));
+        m_portManager->stopPortIntrospection();
+
+        m_sut.reset(
+            new ProcessManager(*m_roudiMemoryManager, *m_portManager, iox::version::CompatibilityCheckLevel::OFF));
+        m_sut->initIntrospection(&m_processIntrospection);
+
+        ASSERT_TRUE(m_sut->registerProcess(ProcessName,
+                                           ProcessId,
+                                           iox::posix::PosixUser::getUserOfCurrentProcess(),
+                                           true,
+                                           0,
+                                           0u,
+                                           iox::version::VersionInfo::getCurrentVersion()));
+        m_sut->addApplicationForProcess(ProcessName);
+
+        auto process = m_sut->getProcessFromList(ProcessName);
+        ASSERT_THAT(process, Ne(nullptr));
+        ASSERT_THAT(process->m_applicationPortData, Ne(nullptr));
+        m_applicationPortData = process->m_applicationPortData;
+    }
+
+    void TearDown() override
+    {
+        m_sut.reset();
+        m_portManager.reset();
+        m_roudiMemoryManager.reset();
+        iox::RelativePointer::unregisterAll();
+
+        if (Test::HasFailure())
+        {
+            std::cout << testing::internal::GetCapturedStderr() << std::endl;
+        }
+        else
+        {
+            (void)testing::internal::GetCapturedStderr();
+        }
+    }
+
+    std::shared_ptr<RouDiProcess> getProcess()
+    {
+        return m_sut->getProcessFromList(ProcessName);
+    }
+
+    /// @brief moves the last sign of life of the process beyond the keep alive timeout
+    void letKeepAliveTimeoutExpire()
+    {
+        getProcess()->setTimestamp(iox::mepoo::BaseClock::now()
+                                   - std::chrono::milliseconds(iox::PROCESS_KEEP_ALIVE_TIMEOUT.milliSeconds<int64_t>())
+                                   - std::chrono::milliseconds(100));
+    }
+
+    static constexpr char ProcessName[]{"/monitoredApp"};
+    static constexpr int32_t ProcessId{4242};
+
+    // receives the REG_ACK and the CREATE_APPLICATION_ACK of the ProcessManager
+    iox::runtime::MqInterfaceCreator m_appMq{ProcessName};
+    std::unique_ptr<IceOryxRouDiMemoryManager> m_roudiMemoryManager;
+    std::unique_ptr<PortManager> m_portManager;
+    iox::roudi::ProcessIntrospectionType m_processIntrospection;
+    std::unique_ptr<ProcessManager> m_sut;
+    iox::popo::ApplicationPortData* m_applicationPortData{nullptr};
+};
+
+constexpr char ProcessManager_test::ProcessName[];
+constexpr int32_t ProcessManager_test::ProcessId;
+
+TEST_F(ProcessManager_test, MonitorProcessesKeepsProcessWithRecentTimestamp)
+{
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(getProcess(), Ne(nullptr));
+}
+
+TEST_F(ProcessManager_test, MonitorProcessesRefreshesTimestampWhenKeepAliveCounterChanged)
+{
+    letKeepAliveTimeoutExpire();
+    const auto outdatedTimestamp = getProcess()->getTimestamp();
+    iox::popo::ApplicationPort(m_applicationPortData).sendKeepAlive();
+
+    const auto timeBeforeMonitoring = iox::mepoo::BaseClock::now();
+    m_sut->monitorProcesses();
+
+    ASSERT_THAT(getProcess(), Ne(nullptr));
+    EXPECT_THAT(getProcess()->getTimestamp(), Gt(outdatedTimestamp));
+    EXPECT_THAT(getProcess()->getTimestamp(), Ge(timeBeforeMonitoring));
+}
+
+TEST_F(ProcessManager_test, MonitorProcessesRemovesProcessWithStalledKeepAliveCounter)
+{
+    iox::popo::ApplicationPort(m_applicationPortData).sendKeepAlive();
+    m_sut->monitorProcesses();
+    ASSERT_THAT(getProcess(), Ne(nullptr));
+
+    letKeepAliveTimeoutExpire();
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(getProcess(), Eq(nullptr));
+}
+
+TEST_F(ProcessManager_test, MonitorProcessesIgnoresKeepAliveCounterOfDestroyedApplicationPort)
+{
+    iox::popo::ApplicationPort applicationPort(m_applicationPortData);
+    applicationPort.destroy();
+    m_sut->monitorProcesses();
+    ASSERT_THAT(getProcess(), Ne(nullptr));
+    EXPECT_THAT(getProcess()->m_applicationPortData, Eq(nullptr));
+
+    letKeepAliveTimeoutExpire();
+    applicationPort.sendKeepAlive();
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(getProcess(), Eq(nullptr));
+}
+
+TEST_F(ProcessManager_test, MonitorProcessesIgnoresKeepAliveCounterOfApplicationPortOfOtherProcess)
+{
+    // the port data was handed over to another process
+    m_applicationPortData->m_processName = iox::ProcessName_t("/otherApp");
+    m_sut->monitorProcesses();
+    ASSERT_THAT(getProcess(), Ne(nullptr));
+    EXPECT_THAT(getProcess()->m_applicationPortData, Eq(nullptr));
+
+    letKeepAliveTimeoutExpire();
+    iox::popo::ApplicationPort(m_applicationPortData).sendKeepAlive();
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(getProcess(), Eq(nullptr));
+}
+
+TEST_F(ProcessManager_test, KeepAliveMessageRefreshesTimestampAfterApplicationPortWasDestroyed)
+{
+    iox::popo::ApplicationPort(m_applicationPortData).destroy();
+    m_sut->monitorProcesses();
+    ASSERT_THAT(getProcess(), Ne(nullptr));
+
+    letKeepAliveTimeoutExpire();
+    m_sut->updateLivelinessOfProcess(ProcessName);
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(getProcess(), Ne(nullptr));
+}
+
+TEST_F(ProcessManager_test, ConcurrentRegistrationsOfDifferentProcessesAreAllAccepted)
+{
+    constexpr uint32_t NUMBER_OF_PROCESSES{8U};
+    std::vector<std::unique_ptr<iox::runtime::MqInterfaceCreator>> appMqs;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        appMqs.emplace_back(new iox::runtime::MqInterfaceCreator("/concurrentApp" + std::to_string(i)));
+    }
+
+    std::atomic<uint32_t> numberOfRegistrations{0U};
+    std::vector<std::thread> registrations;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        registrations.emplace_back([&, i] {
+            iox::ProcessName_t name(iox::cxx::TruncateToCapacity, "/concurrentApp" + std::to_string(i));
+            if (m_sut->registerProcess(name,
+                                       ProcessId + static_cast<int32_t>(i) + 1,
+                                       iox::posix::PosixUser::getUserOfCurrentProcess(),
+                                       false,
+                                       0,
+                                       i + 1U,
+                                       iox::version::VersionInfo::getCurrentVersion()))
+            {
+                ++numberOfRegistrations;
+            }
+        });
+    }
+    for (auto& registration : registrations)
+    {
+        registration.join();
+    }
+
+    EXPECT_THAT(numberOfRegistrations.load(), Eq(NUMBER_OF_PROCESSES));
+    EXPECT_THAT(m_sut->m_processList.size(), Eq(NUMBER_OF_PROCESSES + 1U));
+}
+
+TEST_F(ProcessManager_test, ConcurrentRegistrationsWithTheSameNameAcceptOnlyOneProcess)
+{
+    constexpr uint32_t NUMBER_OF_REGISTRATIONS{8U};
+    constexpr char SAME_NAME[]{"/sameApp"};
+    iox::runtime::MqInterfaceCreator appMq{SAME_NAME};
+
+    std::atomic<uint32_t> numberOfRegistrations{0U};
+    std::vector<std::thread> registrations;
+    for (uint32_t i = 0U; i < NUMBER_OF_REGISTRATIONS; ++i)
+    {
+        registrations.emplace_back([&, i] {
+            if (m_sut->registerProcess(iox::ProcessName_t(SAME_NAME),
+                                       ProcessId + static_cast<int32_t>(i) + 1,
+                                       iox::posix::PosixUser::getUserOfCurrentProcess(),
+                                       true,
+                                       0,
+                                       i + 1U,
+                                       iox::version::VersionInfo::getCurrentVersion()))
+            {
+                ++numberOfRegistrations;
+            }
+        });
+    }
+    for (auto& registration : registrations)
+    {
+        registration.join();
+    }
+
+    EXPECT_THAT(numberOfRegistrations.load(), Eq(1U));
+    EXPECT_THAT(m_sut->m_processList.size(), Eq(2U));
+}
+
+TEST_F(ProcessManager_test, PortRequestOfRemovedProcessDoesNotAcquirePort)
+{
+    auto process = getProcess();
+    ASSERT_THAT(process, Ne(nullptr));
+
+    // the process was looked up by a request before the monitoring removed it
+    process->markAsRemoved();
+    m_sut->addApplicationForProcess(ProcessName);
+
+    EXPECT_THAT(process->m_applicationPortData, Eq(m_applicationPortData));
+}
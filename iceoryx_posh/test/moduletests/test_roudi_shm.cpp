@@ -40,6 +40,7 @@ using iox::popo::SenderPort;
 using iox::roudi::IceOryxRouDiMemoryManager;
 using iox::roudi::PortManager;
 using iox::roudi::PortPoolError;
+using namespace iox::units::duration_literals;
 
 class CShmMangerTester : public PortManager
 {
@@ -192,6 +193,49 @@ TEST_F(PortManager_test, doDiscovery_singleShotReceiverFirstWithDiscovery)
     EXPECT_TRUE(receiver1.isSubscribed());
 }
 
+TEST_F(PortManager_test, doDiscoveryOfNotifiedPorts_connectsSenderAndReceiver)
+{
+    SenderPort sender(m_shmManager->acquireSenderPortData({1, 1, 1}, "/guiseppe", m_payloadMemoryManager).get_value());
+    ASSERT_TRUE(sender);
+    sender.activate();
+
+    ReceiverPort receiver1(m_shmManager->acquireReceiverPortData({1, 1, 1}, "/schlomo"));
+    ASSERT_TRUE(receiver1);
+    receiver1.subscribe(true);
+
+    EXPECT_TRUE(m_shmManager->waitForDiscoveryTrigger(0_ms));
+    m_shmManager->doDiscoveryOfNotifiedPorts();
+
+    EXPECT_THAT(sender.getMembers()->m_receiverHandler.m_receiverVector.size(), Eq(1u));
+    EXPECT_TRUE(receiver1.isSubscribed());
+}
+
+TEST_F(PortManager_test, waitForDiscoveryTriggerWithoutChangesResultsInTimeout)
+{
+    m_shmManager->doDiscovery();
+
+    EXPECT_FALSE(m_shmManager->waitForDiscoveryTrigger(10_ms));
+}
+
+TEST_F(PortManager_test, doDiscoveryOfNotifiedPorts_senderDeactivationIsNotified)
+{
+    SenderPort sender(m_shmManager->acquireSenderPortData({1, 1, 1}, "/guiseppe", m_payloadMemoryManager).get_value());
+    ASSERT_TRUE(sender);
+    sender.activate();
+    ReceiverPort receiver1(m_shmManager->acquireReceiverPortData({1, 1, 1}, "/schlomo"));
+    ASSERT_TRUE(receiver1);
+    receiver1.subscribe(true);
+    m_shmManager->doDiscovery();
+    ASSERT_TRUE(receiver1.isSubscribed());
+
+    sender.deactivate();
+
+    EXPECT_TRUE(m_shmManager->waitForDiscoveryTrigger(0_ms));
+    m_shmManager->doDiscoveryOfNotifiedPorts();
+
+    EXPECT_FALSE(receiver1.isSubscribed());
+}
+
 TEST_F(PortManager_test, doDiscovery_rightOrdering)
 {
     ReceiverPort receiver1(m_shmManager->acquireReceiverPortData({1, 1, 1}, "/schlomo"));
@@ -431,3 +475,36 @@ TEST_F(PortManager_test, PortDestroy)
         EXPECT_FALSE(receiver1.isSubscribed());
     }
 }
+
+TEST_F(PortManager_test, OfferedServiceIsFoundInServiceRegistryTable)
+{
+    SenderPort sender(m_shmManager->acquireSenderPortData({1, 1, 1}, "/guiseppe", m_payloadMemoryManager).get_value());
+    ASSERT_TRUE(sender);
+    sender.activate();
+    m_shmManager->doDiscovery();
+
+    iox::runtime::InstanceContainer instances;
+    uint64_t numberOfFoundInstances{0u};
+    EXPECT_TRUE(m_shmManager->serviceRegistryTable()->find("1", "1", instances, numberOfFoundInstances));
+    EXPECT_THAT(numberOfFoundInstances, Eq(1u));
+
+    sender.deactivate();
+    m_shmManager->doDiscovery();
+
+    EXPECT_TRUE(m_shmManager->serviceRegistryTable()->find("1", "1", instances, numberOfFoundInstances));
+    EXPECT_THAT(numberOfFoundInstances, Eq(0u));
+}
+
+TEST_F(PortManager_test, InterfacePortRequiresLookUpByRouDi)
+{
+    auto interfacePortData = m_shmManager->acquireInterfacePortData(iox::capro::Interfaces::INTERNAL, "/itf");
+    ASSERT_THAT(interfacePortData, Ne(nullptr));
+
+    iox::runtime::InstanceContainer instances;
+    uint64_t numberOfFoundInstances{0u};
+    EXPECT_FALSE(m_shmManager->serviceRegistryTable()->find("1", "1", instances, numberOfFoundInstances));
+
+    m_shmManager->deletePortsOfProcess("/itf");
+
+    EXPECT_TRUE(m_shmManager->serviceRegistryTable()->find("1", "1", instances, numberOfFoundInstances));
+}
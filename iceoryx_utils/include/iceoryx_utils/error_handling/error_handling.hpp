@@ -82,6 +82,7 @@ namespace iox
     error(POPO__WAITSET_CONDITION_VECTOR_OVERFLOW) \
     error(MEPOO__MEMPOOL_CONFIG_MUST_BE_ORDERED_BY_INCREASING_SIZE) \
     error(MEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE) \
+    error(MEPOO__MEMPOOL_GETCHUNK_INVALID_PAYLOAD_ALIGNMENT) \
     error(MEPOO__MEMPOOL_CHUNKSIZE_MUST_BE_LARGER_THAN_SHARED_MEMORY_ALIGNMENT_AND_MULTIPLE_OF_ALIGNMENT) \
     error(MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL) \
     error(MEPOO__TYPED_MEMPOOL_HAS_INCONSISTENT_STATE) \
@@ -54,6 +54,18 @@ class LockedLoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const uint32_t index);
 
+    /// Pop up to f_numberOfIndices values from the free-list at once
+    /// @param [out] f_indices storage for the popped indices, must have room for f_numberOfIndices elements
+    /// @param [in] f_numberOfIndices the maximum number of indices to pop
+    /// @return the number of popped indices, 0 if the free-list is empty
+    uint32_t popN(uint32_t* const f_indices, const uint32_t f_numberOfIndices);
+
+    /// Push previously popped elements at once
+    /// @param [in] f_indices pointer to the previously popped elements
+    /// @param [in] f_numberOfIndices number of elements in f_indices
+    /// @return true if all indices are valid and not yet pushed, false otherwise; then none of the indices is pushed
+    bool pushN(const uint32_t* const f_indices, const uint32_t f_numberOfIndices);
+
     /// Calculates the required memory size for a free-list
     /// @param [in] f_size is the number of elements of the free-list
     /// @return the required memory size for a free-list with f_size elements
@@ -91,6 +91,24 @@ class MessageQueue : public DesignPattern::Creation<MessageQueue, IpcChannelErro
     /// @brief try to send a message to the queue for a given timeout duration using std::string
     cxx::expected<IpcChannelError> timedSend(const std::string& msg, const units::Duration& timeout) const;
 
+    /// @brief send a raw message of size bytes to the queue. The message is not required to be null terminated
+    /// and may contain null characters.
+    cxx::expected<IpcChannelError> send(const void* const msg, const size_t size) const;
+
+    /// @brief try to send a raw message of size bytes to the queue for a given timeout duration
+    cxx::expected<IpcChannelError>
+    timedSend(const void* const msg, const size_t size, const units::Duration& timeout) const;
+
+    /// @brief receive a raw message from the queue into the provided buffer without any heap allocation. The
+    /// buffer must be at least as large as the max message size of the queue.
+    /// @return the number of bytes received
+    cxx::expected<size_t, IpcChannelError> receive(void* const buffer, const size_t bufferSize) const;
+
+    /// @brief try to receive a raw message from the queue into the provided buffer for a given timeout duration
+    /// @return the number of bytes received
+    cxx::expected<size_t, IpcChannelError>
+    timedReceive(void* const buffer, const size_t bufferSize, const units::Duration& timeout) const;
+
     cxx::expected<bool, IpcChannelError> isOutdated();
 
   private:
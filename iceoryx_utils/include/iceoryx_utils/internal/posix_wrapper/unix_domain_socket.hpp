@@ -97,6 +97,35 @@ class UnixDomainSocket : public DesignPattern::Creation<UnixDomainSocket, IpcCha
     /// @return received message. In case of an error, IpcChannelError is returned and msg is empty.
     cxx::expected<std::string, IpcChannelError> timedReceive(const units::Duration& timeout) const noexcept;
 
+    /// @brief send a raw message of size bytes. The message is not required to be null terminated and may contain
+    /// null characters.
+    /// @param msg pointer to the message
+    /// @param size of the message in bytes
+    /// @return IpcChannelError if error occured
+    cxx::expected<IpcChannelError> send(const void* const msg, const size_t size) const noexcept;
+
+    /// @brief try to send a raw message of size bytes for a given timeout duration
+    /// @param msg pointer to the message
+    /// @param size of the message in bytes
+    /// @param timout for the send operation
+    /// @return IpcChannelError if error occured
+    cxx::expected<IpcChannelError>
+    timedSend(const void* const msg, const size_t size, const units::Duration& timeout) const noexcept;
+
+    /// @brief receive a raw message into the provided buffer without any heap allocation
+    /// @param buffer to store the message
+    /// @param bufferSize size of the buffer in bytes
+    /// @return number of bytes received, IpcChannelError if error occured
+    cxx::expected<size_t, IpcChannelError> receive(void* const buffer, const size_t bufferSize) const noexcept;
+
+    /// @brief try to receive a raw message into the provided buffer for a given timeout duration
+    /// @param buffer to store the message
+    /// @param bufferSize size of the buffer in bytes
+    /// @param timout for the receive operation
+    /// @return number of bytes received, IpcChannelError if error occured
+    cxx::expected<size_t, IpcChannelError>
+    timedReceive(void* const buffer, const size_t bufferSize, const units::Duration& timeout) const noexcept;
+
     /// @brief checks whether the unix domain socket is outdated
     /// @return true if the unix domain socket is outdated, false otherwise, IpcChannelError if error occured
     cxx::expected<bool, IpcChannelError> isOutdated() noexcept;
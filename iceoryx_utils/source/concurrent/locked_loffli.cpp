@@ -71,5 +71,52 @@ bool LockedLoFFLi::push(const uint32_t index)
     return true;
 }
 
+uint32_t LockedLoFFLi::popN(uint32_t* const f_indices, const uint32_t f_numberOfIndices)
+{
+    std::lock_guard<posix::mutex> lock(m_accessMutex);
+
+    uint32_t numberOfIndices{0u};
+    while (numberOfIndices < f_numberOfIndices && m_head < m_size)
+    {
+        f_indices[numberOfIndices] = m_head;
+        m_head = m_freeIndices[m_head];
+        m_freeIndices[f_indices[numberOfIndices]] = m_invalidIndex;
+        ++numberOfIndices;
+    }
+
+    return numberOfIndices;
+}
+
+bool LockedLoFFLi::pushN(const uint32_t* const f_indices, const uint32_t f_numberOfIndices)
+{
+    std::lock_guard<posix::mutex> lock(m_accessMutex);
+
+    // link the indices to a run, an index which occurs twice is detected since it is already linked
+    for (uint32_t i = 0u; i < f_numberOfIndices; ++i)
+    {
+        if (i > 0u)
+        {
+            m_freeIndices[f_indices[i - 1u]] = f_indices[i];
+        }
+
+        if (f_indices[i] >= m_size || m_freeIndices[f_indices[i]] != m_invalidIndex)
+        {
+            for (uint32_t k = 0u; k < i; ++k)
+            {
+                m_freeIndices[f_indices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+    }
+
+    if (f_numberOfIndices > 0u)
+    {
+        m_freeIndices[f_indices[f_numberOfIndices - 1u]] = m_head;
+        m_head = f_indices[0u];
+    }
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
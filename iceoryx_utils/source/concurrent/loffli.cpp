@@ -98,5 +98,97 @@ bool LoFFLi::push(const uint32_t index)
     return true;
 }
 
+uint32_t LoFFLi::popN(uint32_t* const f_indices, const uint32_t f_numberOfIndices)
+{
+    if (f_numberOfIndices == 0u)
+    {
+        return 0u;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0u};
+
+    do
+    {
+        // we are empty if next points to an element with index of Size
+        if (oldHead.indexToNextFreeIndex >= m_size)
+        {
+            return 0u;
+        }
+
+        /// @brief the run of indices might be modified concurrently while we walk along it, then we read arbitrary
+        ///         indices but the compare and swap fails since every pop and push changes the aba counter
+        numberOfIndices = 1u;
+        uint32_t nextIndex = m_nextFreeIndex[oldHead.indexToNextFreeIndex];
+        while (numberOfIndices < f_numberOfIndices && nextIndex < m_size)
+        {
+            nextIndex = m_nextFreeIndex[nextIndex];
+            ++numberOfIndices;
+        }
+
+        newHead.indexToNextFreeIndex = nextIndex;
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    /// the run of indices is now exclusively owned and can be collected without synchronization
+    uint32_t index = oldHead.indexToNextFreeIndex;
+    for (uint32_t i = 0u; i < numberOfIndices; ++i)
+    {
+        f_indices[i] = index;
+        index = m_nextFreeIndex[index];
+        m_nextFreeIndex[f_indices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::pushN(const uint32_t* const f_indices, const uint32_t f_numberOfIndices)
+{
+    if (f_numberOfIndices == 0u)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// link the indices to a run; every index is checked after it was linked to its predecessor, therefore an index
+    /// which occurs twice in f_indices is detected like one which was not acquired in pop
+    for (uint32_t i = 0u; i < f_numberOfIndices; ++i)
+    {
+        if (i > 0u)
+        {
+            m_nextFreeIndex[f_indices[i - 1u]] = f_indices[i];
+        }
+
+        if (f_indices[i] >= m_size || m_nextFreeIndex[f_indices[i]] != m_invalidIndex)
+        {
+            for (uint32_t k = 0u; k < i; ++k)
+            {
+                m_nextFreeIndex[f_indices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+    }
+
+    const uint32_t lastIndex = f_indices[f_numberOfIndices - 1u];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = f_indices[0u];
+        newHead.abaCounter += 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
@@ -165,8 +165,12 @@ cxx::expected<IpcChannelError> MessageQueue::destroy()
 
 cxx::expected<IpcChannelError> MessageQueue::send(const std::string& msg) const
 {
-    const size_t messageSize = static_cast<size_t>(msg.size()) + NULL_TERMINATOR_SIZE;
-    if (messageSize > static_cast<size_t>(m_attributes.mq_msgsize))
+    return send(msg.c_str(), static_cast<size_t>(msg.size()) + NULL_TERMINATOR_SIZE);
+}
+
+cxx::expected<IpcChannelError> MessageQueue::send(const void* const msg, const size_t size) const
+{
+    if (size > static_cast<size_t>(m_attributes.mq_msgsize))
     {
         return cxx::error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
@@ -176,8 +180,8 @@ cxx::expected<IpcChannelError> MessageQueue::send(const std::string& msg) const
                                   {ERROR_CODE},
                                   {},
                                   m_mqDescriptor,
-                                  msg.c_str(),
-                                  messageSize,
+                                  static_cast<const char*>(msg),
+                                  size,
                                   1);
 
     if (mqCall.hasErrors())
@@ -191,13 +195,24 @@ cxx::expected<IpcChannelError> MessageQueue::send(const std::string& msg) const
 cxx::expected<std::string, IpcChannelError> MessageQueue::receive() const
 {
     char message[MAX_MESSAGE_SIZE];
+    auto result = receive(message, MAX_MESSAGE_SIZE);
+    if (result.has_error())
+    {
+        return cxx::error<IpcChannelError>(result.get_error());
+    }
+
+    return cxx::success<std::string>(std::string(&(message[0])));
+}
+
+cxx::expected<size_t, IpcChannelError> MessageQueue::receive(void* const buffer, const size_t bufferSize) const
+{
     auto mqCall = cxx::makeSmartC(mq_receive,
                                   cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
                                   {static_cast<ssize_t>(ERROR_CODE)},
                                   {},
                                   m_mqDescriptor,
-                                  message,
-                                  MAX_MESSAGE_SIZE,
+                                  static_cast<char*>(buffer),
+                                  bufferSize,
                                   nullptr);
 
     if (mqCall.hasErrors())
@@ -205,7 +220,7 @@ cxx::expected<std::string, IpcChannelError> MessageQueue::receive() const
         return createErrorFromErrnum(mqCall.getErrNum());
     }
 
-    return cxx::success<std::string>(std::string(&(message[0])));
+    return cxx::success<size_t>(static_cast<size_t>(mqCall.getReturnValue()));
 }
 
 cxx::expected<int32_t, IpcChannelError>
@@ -291,16 +306,28 @@ cxx::expected<IpcChannelError> MessageQueue::unlink()
 
 cxx::expected<std::string, IpcChannelError> MessageQueue::timedReceive(const units::Duration& timeout) const
 {
-    timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
     char message[MAX_MESSAGE_SIZE];
+    auto result = timedReceive(message, MAX_MESSAGE_SIZE, timeout);
+    if (result.has_error())
+    {
+        return cxx::error<IpcChannelError>(result.get_error());
+    }
+
+    return cxx::success<std::string>(std::string(&(message[0])));
+}
+
+cxx::expected<size_t, IpcChannelError>
+MessageQueue::timedReceive(void* const buffer, const size_t bufferSize, const units::Duration& timeout) const
+{
+    timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
 
     auto mqCall = cxx::makeSmartC(mq_timedreceive,
                                   cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
                                   {static_cast<ssize_t>(ERROR_CODE)},
                                   {TIMEOUT_ERRNO},
                                   m_mqDescriptor,
-                                  message,
-                                  MAX_MESSAGE_SIZE,
+                                  static_cast<char*>(buffer),
+                                  bufferSize,
                                   nullptr,
                                   &timeOut);
 
@@ -313,7 +340,7 @@ cxx::expected<std::string, IpcChannelError> MessageQueue::timedReceive(const uni
         return createErrorFromErrnum(ETIMEDOUT);
     }
 
-    return cxx::success<std::string>(std::string(&(message[0])));
+    return cxx::success<size_t>(static_cast<size_t>(mqCall.getReturnValue()));
 }
 
 cxx::expected<IpcChannelError> MessageQueue::timedSend(const std::string& msg, const units::Duration& timeout) const
@@ -326,6 +353,17 @@ cxx::expected<IpcChannelError> MessageQueue::timedSend(const std::string& msg, c
         return cxx::error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
 
+    return timedSend(msg.c_str(), messageSize, timeout);
+}
+
+cxx::expected<IpcChannelError>
+MessageQueue::timedSend(const void* const msg, const size_t size, const units::Duration& timeout) const
+{
+    if (size > static_cast<size_t>(m_attributes.mq_msgsize))
+    {
+        return cxx::error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
+    }
+
     timespec timeOut = timeout.timespec(units::TimeSpecReference::Epoch);
 
     auto mqCall = cxx::makeSmartC(mq_timedsend,
@@ -333,8 +371,8 @@ cxx::expected<IpcChannelError> MessageQueue::timedSend(const std::string& msg, c
                                   {ERROR_CODE},
                                   {TIMEOUT_ERRNO},
                                   m_mqDescriptor,
-                                  msg.c_str(),
-                                  messageSize,
+                                  static_cast<const char*>(msg),
+                                  size,
                                   1,
                                   &timeOut);
 
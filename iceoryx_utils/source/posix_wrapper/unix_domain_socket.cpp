@@ -191,7 +191,18 @@ cxx::expected<IpcChannelError> UnixDomainSocket::send(const std::string& msg) co
 cxx::expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& msg, const units::Duration& timeout) const
     noexcept
 {
-    if (msg.size() >= m_maxMessageSize) // message sizes with null termination must be smaller than m_maxMessageSize
+    return timedSend(msg.c_str(), static_cast<size_t>(msg.size() + 1), timeout); // +1 for the \0 at the end
+}
+
+cxx::expected<IpcChannelError> UnixDomainSocket::send(const void* const msg, const size_t size) const noexcept
+{
+    return timedSend(msg, size, units::Duration::seconds(0ULL));
+}
+
+cxx::expected<IpcChannelError>
+UnixDomainSocket::timedSend(const void* const msg, const size_t size, const units::Duration& timeout) const noexcept
+{
+    if (size > m_maxMessageSize)
     {
         return cxx::error<IpcChannelError>(IpcChannelError::MESSAGE_TOO_LONG);
     }
@@ -234,8 +245,8 @@ cxx::expected<IpcChannelError> UnixDomainSocket::timedSend(const std::string& ms
                                         {static_cast<ssize_t>(ERROR_CODE)},
                                         {},
                                         m_sockfd,
-                                        msg.c_str(),
-                                        static_cast<size_t>(msg.size() + 1), // +1 for the \0 at the end
+                                        msg,
+                                        size,
                                         static_cast<int>(0),
                                         nullptr, // socket address not used for a connected SOCK_DGRAM
                                         static_cast<socklen_t>(0));
@@ -265,6 +276,31 @@ cxx::expected<std::string, IpcChannelError> UnixDomainSocket::receive() const no
 
 cxx::expected<std::string, IpcChannelError> UnixDomainSocket::timedReceive(const units::Duration& timeout) const
     noexcept
+{
+    char message[MAX_MESSAGE_SIZE + 1];
+    auto result = timedReceive(message, MAX_MESSAGE_SIZE, timeout);
+    if (result.has_error())
+    {
+        return cxx::error<IpcChannelError>(result.get_error());
+    }
+    message[MAX_MESSAGE_SIZE] = 0;
+
+    return cxx::success<std::string>(std::string(message));
+}
+
+cxx::expected<size_t, IpcChannelError> UnixDomainSocket::receive(void* const buffer, const size_t bufferSize) const
+    noexcept
+{
+    struct timeval tv;
+    tv.tv_sec = 0;
+    tv.tv_usec = 0;
+
+    return timedReceive(buffer, bufferSize, units::Duration(tv));
+}
+
+cxx::expected<size_t, IpcChannelError>
+UnixDomainSocket::timedReceive(void* const buffer, const size_t bufferSize, const units::Duration& timeout) const
+    noexcept
 {
     if (IpcChannelSide::CLIENT == m_channelSide)
     {
@@ -290,18 +326,16 @@ cxx::expected<std::string, IpcChannelError> UnixDomainSocket::timedReceive(const
     }
     else
     {
-        char message[MAX_MESSAGE_SIZE + 1];
         auto recvCall = cxx::makeSmartC(recvfrom,
                                         cxx::ReturnMode::PRE_DEFINED_ERROR_CODE,
                                         {static_cast<ssize_t>(ERROR_CODE)},
                                         {EAGAIN},
                                         m_sockfd,
-                                        &(message[0]),
-                                        MAX_MESSAGE_SIZE,
+                                        buffer,
+                                        bufferSize,
                                         0,
                                         nullptr,
                                         nullptr);
-        message[MAX_MESSAGE_SIZE] = 0;
 
         if (recvCall.hasErrors())
         {
@@ -315,7 +349,7 @@ cxx::expected<std::string, IpcChannelError> UnixDomainSocket::timedReceive(const
         }
         else
         {
-            return cxx::success<std::string>(std::string(message));
+            return cxx::success<size_t>(static_cast<size_t>(recvCall.getReturnValue()));
         }
     }
 }
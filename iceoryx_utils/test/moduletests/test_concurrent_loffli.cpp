@@ -12,12 +12,18 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include "timing_test.hpp"
+
 #include "iceoryx_utils/internal/concurrent/locked_loffli.hpp"
 #include "iceoryx_utils/internal/concurrent/loffli.hpp"
 #include "test.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <random>
+#include <set>
+#include <thread>
 #include <vector>
 
 using namespace ::testing;
@@ -195,3 +201,255 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopNReturnsIndicesInOrder)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popN(indices, Size - 1), Eq(Size - 1));
+
+    for (uint32_t i = 0; i < Size - 1; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1));
+}
+
+TYPED_TEST(LoFFLi_test, PopNMoreThanAvailableReturnsRemainingIndices)
+{
+    uint32_t index;
+    this->m_loffli.pop(index);
+
+    uint32_t indices[Size + 2];
+    EXPECT_THAT(this->m_loffli.popN(indices, Size + 2), Eq(Size - 1));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopNEmpty)
+{
+    uint32_t indices[Size];
+    this->m_loffli.popN(indices, Size);
+
+    EXPECT_THAT(this->m_loffli.popN(indices, Size), Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, PopNZeroIndices)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popN(indices, 0), Eq(0u));
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, PopNFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popN(indices, Size), Eq(0u));
+}
+
+TYPED_TEST(LoFFLi_test, PushNPoppedIndices)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+
+    std::reverse(indices, indices + Size);
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size), Eq(true));
+
+    // the pushed run is popped in the order it was pushed
+    for (uint32_t i = 0; i < Size; i++)
+    {
+        uint32_t index;
+        EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+        EXPECT_THAT(index, Eq(indices[i]));
+    }
+}
+
+TYPED_TEST(LoFFLi_test, PushNSingleIndicesFromPop)
+{
+    std::vector<uint32_t> useList;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useList.push_back(index);
+    }
+
+    EXPECT_THAT(this->m_loffli.pushN(useList.data() + 1, Size - 1), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(useList[0]), Eq(true));
+    EXPECT_THAT(this->m_loffli.push(useList[0]), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushNZeroIndices)
+{
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.pushN(indices, 0), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithNotPoppedIndexPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 2), Eq(2u));
+    indices[2] = 3;
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 3), Eq(false));
+
+    // the valid indices are still popped and can be pushed
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithOutOfBoundIndexPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 2), Eq(2u));
+    indices[2] = Size + 42;
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 3), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithDuplicateIndexPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 2), Eq(2u));
+
+    uint32_t consecutiveDuplicate[] = {indices[0], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushN(consecutiveDuplicate, 2), Eq(false));
+    uint32_t duplicate[] = {indices[0], indices[1], indices[0]};
+    EXPECT_THAT(this->m_loffli.pushN(duplicate, 3), Eq(false));
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWhenFull)
+{
+    uint32_t indices[] = {0, 1};
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2), Eq(false));
+}
+
+class LoFFLiThroughput_test : public Test
+{
+  public:
+    static constexpr uint32_t Size{1024};
+    static constexpr uint32_t BatchSize{64};
+    static constexpr uint32_t NumberOfThreads{4};
+
+    void SetUp() override
+    {
+        m_loffli.init(m_memoryLoFFLi, Size);
+    }
+
+    /// @brief pops and pushes BatchSize indices for the given number of rounds, with popN and pushN if batch is
+    /// true and with pop and push otherwise
+    /// @return the number of indices which were popped and pushed per millisecond
+    double measureThroughput(const uint64_t numberOfRounds, const bool batch)
+    {
+        uint32_t indices[BatchSize];
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t round = 0; round < numberOfRounds; ++round)
+        {
+            if (batch)
+            {
+                EXPECT_THAT(m_loffli.popN(indices, BatchSize), Eq(BatchSize));
+                EXPECT_THAT(m_loffli.pushN(indices, BatchSize), Eq(true));
+            }
+            else
+            {
+                for (auto& index : indices)
+                {
+                    EXPECT_THAT(m_loffli.pop(index), Eq(true));
+                }
+                for (auto index : indices)
+                {
+                    EXPECT_THAT(m_loffli.push(index), Eq(true));
+                }
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        auto durationInMicroSeconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        return static_cast<double>(numberOfRounds * BatchSize * 1000u)
+               / static_cast<double>(std::max<int64_t>(durationInMicroSeconds, 1));
+    }
+
+    uint32_t m_memoryLoFFLi[iox::concurrent::LoFFLi::requiredMemorySize(Size)];
+    iox::concurrent::LoFFLi m_loffli;
+};
+
+constexpr uint32_t LoFFLiThroughput_test::Size;
+constexpr uint32_t LoFFLiThroughput_test::BatchSize;
+constexpr uint32_t LoFFLiThroughput_test::NumberOfThreads;
+
+TEST_F(LoFFLiThroughput_test, ConcurrentPopNAndPushNKeepAllIndices)
+{
+    constexpr uint64_t NumberOfRounds{10000};
+    std::atomic_bool start{false};
+    std::atomic<uint64_t> numberOfFailedPushes{0};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < NumberOfThreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            std::mt19937 generator(t);
+            std::uniform_int_distribution<uint32_t> batchSize(1, BatchSize);
+            uint32_t indices[BatchSize];
+            while (!start.load())
+            {
+                std::this_thread::yield();
+            }
+
+            for (uint64_t round = 0; round < NumberOfRounds; ++round)
+            {
+                auto numberOfIndices = m_loffli.popN(indices, batchSize(generator));
+                // mix the batch operations with single operations
+                if (round % 2 == 0)
+                {
+                    if (!m_loffli.pushN(indices, numberOfIndices))
+                    {
+                        numberOfFailedPushes.fetch_add(1);
+                    }
+                }
+                else
+                {
+                    for (uint32_t i = 0; i < numberOfIndices; ++i)
+                    {
+                        if (!m_loffli.push(indices[i]))
+                        {
+                            numberOfFailedPushes.fetch_add(1);
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    start.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(numberOfFailedPushes.load(), Eq(0u));
+
+    std::set<uint32_t> remainingIndices;
+    uint32_t index;
+    while (m_loffli.pop(index))
+    {
+        remainingIndices.insert(index);
+    }
+    EXPECT_THAT(remainingIndices.size(), Eq(Size));
+    EXPECT_THAT(*remainingIndices.rbegin(), Eq(Size - 1));
+}
+
+TIMING_TEST_F(LoFFLiThroughput_test, BatchOperationsHaveHigherThroughputThanSingleOperations, Repeat(5), [&] {
+    constexpr uint64_t NumberOfRounds{20000};
+
+    auto singleThroughput = measureThroughput(NumberOfRounds, false);
+    auto batchThroughput = measureThroughput(NumberOfRounds, true);
+
+    std::cout << "LoFFLi throughput in indices per ms, single: " << singleThroughput
+              << ", batch of " << BatchSize << ": " << batchThroughput << std::endl;
+    TIMING_TEST_EXPECT_TRUE(batchThroughput > singleThroughput);
+});
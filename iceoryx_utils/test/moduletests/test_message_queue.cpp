@@ -19,6 +19,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <cstring>
 
 using namespace ::testing;
 using namespace iox;
@@ -291,6 +292,34 @@ TEST_F(MessageQueue_test, sendMaxMessageSize)
     EXPECT_EQ(message, receivedMessage.get_value());
 }
 
+TEST_F(MessageQueue_test, sendAndReceiveRawBufferWithEmbeddedNullCharacters)
+{
+    const uint8_t message[] = {0xA5, 0x01, 0x00, 0x00, 0x2A, 0x00, 0xFF};
+    ASSERT_THAT(client.send(message, sizeof(message)).has_error(), Eq(false));
+
+    uint8_t buffer[IpcChannelType::MAX_MESSAGE_SIZE];
+    auto receivedSize = server.receive(buffer, sizeof(buffer));
+    ASSERT_THAT(receivedSize.has_error(), Eq(false));
+    ASSERT_THAT(receivedSize.get_value(), Eq(sizeof(message)));
+    EXPECT_THAT(memcmp(buffer, message, sizeof(message)), Eq(0));
+}
+
+TEST_F(MessageQueue_test, sendRawBufferLargerThanMaxMessageSizeFails)
+{
+    uint8_t message[IpcChannelType::MAX_MESSAGE_SIZE + 1] = {0u};
+    EXPECT_THAT(client.send(message, sizeof(message)).has_error(), Eq(true));
+}
+
+TEST_F(MessageQueue_test, rawBufferAndStringMessagesCanBeMixed)
+{
+    std::string stringMessage = "Iceoryx rules.";
+    ASSERT_THAT(client.send(stringMessage.c_str(), stringMessage.size() + 1u).has_error(), Eq(false));
+
+    auto receivedMessage = server.receive();
+    ASSERT_THAT(receivedMessage.has_error(), Eq(false));
+    EXPECT_EQ(stringMessage, receivedMessage.get_value());
+}
+
 TEST_F(MessageQueue_test, wildCreate)
 {
     auto result = IpcChannelType::create();
@@ -364,4 +393,22 @@ TEST_F(MessageQueue_test, timedReceive)
     // Check if timedReceive has blocked for ~timeout and has not returned immediately
     EXPECT_GT(timeDiff_ms.count(), (timeout - minTimeoutTolerance).milliSeconds<int64_t>());
 }
+
+TEST_F(MessageQueue_test, timedReceiveRawBuffer)
+{
+    using namespace iox::units;
+
+    const uint64_t message{0x00FF00FF00FF00FFu};
+    ASSERT_THAT(client.send(&message, sizeof(message)).has_error(), Eq(false));
+
+    uint8_t buffer[IpcChannelType::MAX_MESSAGE_SIZE];
+    auto receivedSize = server.timedReceive(buffer, sizeof(buffer), 100_ms);
+    ASSERT_THAT(receivedSize.has_error(), Eq(false));
+    ASSERT_THAT(receivedSize.get_value(), Eq(sizeof(message)));
+    EXPECT_THAT(memcmp(buffer, &message, sizeof(message)), Eq(0));
+
+    receivedSize = server.timedReceive(buffer, sizeof(buffer), 10_ms);
+    ASSERT_TRUE(receivedSize.has_error());
+    EXPECT_THAT(receivedSize.get_error(), Eq(IpcChannelError::TIMEOUT));
+}
 #endif
@@ -149,6 +149,9 @@ class IntrospectionApp
     void printPortIntrospectionData(const std::vector<ComposedSenderPortData>& senderPortData,
                                     const std::vector<ComposedReceiverPortData>& receiverPortData);
 
+    /// @brief Formats the mean and the max of a latency histogram in microseconds
+    static std::string latencyToString(const LatencyHistogramData& latency);
+
     /// @brief Prints help to the command line
     void printHelp() noexcept;
 
@@ -264,14 +264,16 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t payloadSizeWidth{13};
+    constexpr int32_t spilledChunksWidth{8};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", payloadSizeWidth, "Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", payloadSizeWidth, "Payload Size");
+    wprintw(pad, "%*s\n", spilledChunksWidth, "Spilled");
+    wprintw(pad, "------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -283,7 +285,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", payloadSizeWidth, info.m_payloadSize);
+            wprintw(pad, "%*d |", payloadSizeWidth, info.m_payloadSize);
+            wprintw(pad, "%*d\n", spilledChunksWidth, info.m_spilledChunks);
         }
     }
     wprintw(pad, "\n");
@@ -508,7 +511,28 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedSend
             prettyPrint("disconnected", PrettyOptions::error);
         }
         wprintw(pad, "\n");
+
+        // the latencies are only recorded when the sender port enabled the latency tracing
+        auto& changingData = *receiver.receiverPortChangingData;
+        if (changingData.sendToDeliverLatency.m_count > 0u)
+        {
+            wprintw(pad,
+                    "    latency since send, mean / max [Microseconds]: deliver %s | get %s | release %s\n",
+                    latencyToString(changingData.sendToDeliverLatency).c_str(),
+                    latencyToString(changingData.sendToGetLatency).c_str(),
+                    latencyToString(changingData.sendToReleaseLatency).c_str());
+        }
+    }
+}
+
+std::string IntrospectionApp::latencyToString(const LatencyHistogramData& latency)
+{
+    if (latency.m_count == 0u)
+    {
+        return "- / -";
     }
+    return std::to_string(latency.m_sumInNanoseconds / latency.m_count / 1000u) + " / "
+           + std::to_string(latency.m_maxInNanoseconds / 1000u);
 }
 
 bool IntrospectionApp::waitForSubscription(SubscriberType& port)